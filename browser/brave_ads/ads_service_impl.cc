@@ -24,7 +24,9 @@
 #include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/metrics/field_trial_params.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/no_destructor.h"
+#include "base/numerics/safe_conversions.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
@@ -126,6 +128,8 @@ const unsigned int kRetriesCountOnNetworkChange = 1;
 
 constexpr char kAdNotificationUrlPrefix[] = "https://www.brave.com/ads/?";
 
+constexpr base::TimeDelta kRecordStateBytesWrittenInterval = base::Hours(1);
+
 const base::Feature kAdServing{"AdServing", base::FEATURE_ENABLED_BY_DEFAULT};
 
 int GetDataResourceId(const std::string& name) {
@@ -553,6 +557,8 @@ void AdsServiceImpl::Shutdown() {
 
   idle_poll_timer_.Stop();
 
+  state_bytes_written_timer_.Stop();
+
   bat_ads_.reset();
   bat_ads_client_receiver_.reset();
   bat_ads_service_.reset();
@@ -681,6 +687,8 @@ void AdsServiceImpl::OnInitialize(const bool success) {
 
   StartCheckIdleStateTimer();
 
+  StartRecordStateBytesWrittenTimer();
+
   if (!deprecated_data_files_removed_) {
     deprecated_data_files_removed_ = true;
     file_task_runner_->PostTask(
@@ -958,6 +966,20 @@ void AdsServiceImpl::StartCheckIdleStateTimer() {
 #endif
 }
 
+void AdsServiceImpl::StartRecordStateBytesWrittenTimer() {
+  state_bytes_written_timer_.Stop();
+
+  state_bytes_written_timer_.Start(FROM_HERE, kRecordStateBytesWrittenInterval,
+                                   this,
+                                   &AdsServiceImpl::RecordStateBytesWritten);
+}
+
+void AdsServiceImpl::RecordStateBytesWritten() {
+  const int kilobytes = base::saturated_cast<int>(state_bytes_written_ / 1024);
+  UMA_HISTOGRAM_MEMORY_KB("Brave.Ads.StateKBWrittenPerHour", kilobytes);
+  state_bytes_written_ = 0;
+}
+
 void AdsServiceImpl::CheckIdleState() {
   const int idle_threshold = GetIdleTimeThreshold();
   const ui::IdleState idle_state = ui::CalculateIdleState(idle_threshold);
@@ -2053,6 +2075,8 @@ void AdsServiceImpl::UrlRequest(ads::mojom::UrlRequestPtr url_request,
 void AdsServiceImpl::Save(const std::string& name,
                           const std::string& value,
                           ads::ResultCallback callback) {
+  state_bytes_written_ += value.size();
+
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&base::ImportantFileWriter::WriteFileAtomically,
@@ -258,6 +258,9 @@ class AdsServiceImpl : public AdsService,
   void ProcessIdleState(const ui::IdleState idle_state, const int idle_time);
   int GetIdleTimeThreshold();
 
+  void StartRecordStateBytesWrittenTimer();
+  void RecordStateBytesWritten();
+
   bool ShouldShowCustomAdNotifications();
 
   void MaybeOpenNewTabWithAd();
@@ -516,6 +519,10 @@ class AdsServiceImpl : public AdsService,
 
   base::RepeatingTimer idle_poll_timer_;
 
+  // Bytes of state saved by the ads library since last recorded
+  uint64_t state_bytes_written_ = 0;
+  base::RepeatingTimer state_bytes_written_timer_;
+
   PrefChangeRegistrar profile_pref_change_registrar_;
 
   SimpleURLLoaderList url_loaders_;
@@ -3400,4 +3400,91 @@ TEST_F(KeyringServiceAccountDiscoveryUnitTest, RestoreWalletTwice) {
   EXPECT_THAT(requested_addresses, ElementsAreArray(&saved_addresses()[1], 30));
 }
 
+class KeyringServiceParallelAccountDiscoveryUnitTest
+    : public KeyringServiceAccountDiscoveryUnitTest {
+ public:
+  KeyringServiceParallelAccountDiscoveryUnitTest() {
+    feature_list_.InitAndEnableFeatureWithParameters(
+        features::kBraveWalletParallelAccountDiscoveryFeature,
+        {{"requests_in_flight", "5"}});
+  }
+
+ private:
+  base::test::ScopedFeatureList feature_list_;
+};
+
+TEST_F(KeyringServiceParallelAccountDiscoveryUnitTest, AccountDiscovery) {
+  KeyringService service(json_rpc_service(), GetPrefs());
+
+  TestKeyringServiceObserver observer;
+  service.AddObserver(observer.GetReceiver());
+
+  std::vector<std::string> requested_addresses;
+  set_transaction_count_callback(base::BindLambdaForTesting(
+      [this, &requested_addresses](const std::string& address) -> std::string {
+        requested_addresses.push_back(address);
+
+        // 3rd and 10th have transactions.
+        if (address == saved_addresses()[3] || address == saved_addresses()[10])
+          return R"({"jsonrpc":"2.0","id":"1","result":"0x1"})";
+        else
+          return R"({"jsonrpc":"2.0","id":"1","result":"0x0"})";
+      }));
+
+  EXPECT_TRUE(RestoreWallet(&service, saved_mnemonic(), "brave1", false));
+  base::RunLoop().RunUntilIdle();
+  std::vector<mojom::AccountInfoPtr> account_infos =
+      service.GetAccountInfosForKeyring(mojom::kDefaultKeyringId);
+  EXPECT_EQ(account_infos.size(), 11u);
+  for (size_t i = 0; i < account_infos.size(); ++i) {
+    EXPECT_EQ(account_infos[i]->address, saved_addresses()[i]);
+    EXPECT_EQ(account_infos[i]->name, "Account " + std::to_string(i + 1));
+  }
+  // Accounts 3 and 10.
+  EXPECT_EQ(2, observer.AccountsChangedFiredCount());
+  // Nothing past the last of the 20 attempts after Account 10 is requested.
+  EXPECT_THAT(requested_addresses, ElementsAreArray(&saved_addresses()[1], 30));
+}
+
+TEST_F(KeyringServiceParallelAccountDiscoveryUnitTest, StopsOnError) {
+  KeyringService service(json_rpc_service(), GetPrefs());
+
+  TestKeyringServiceObserver observer;
+  service.AddObserver(observer.GetReceiver());
+
+  std::vector<std::string> requested_addresses;
+  set_transaction_count_callback(base::BindLambdaForTesting(
+      [this, &requested_addresses](const std::string& address) -> std::string {
+        requested_addresses.push_back(address);
+
+        // 3rd and 12th accounts have transactions. Checking 8th account ends
+        // with network error, so 12th is never added.
+        if (address == saved_addresses()[3] || address == saved_addresses()[12])
+          return R"({"jsonrpc":"2.0","id":"1","result":"0x1"})";
+        else if (address == saved_addresses()[8])
+          return "error";
+        else
+          return R"({"jsonrpc":"2.0","id":"1","result":"0x0"})";
+      }));
+
+  EXPECT_TRUE(RestoreWallet(&service, saved_mnemonic(), "brave1", false));
+  base::RunLoop().RunUntilIdle();
+  std::vector<mojom::AccountInfoPtr> account_infos =
+      service.GetAccountInfosForKeyring(mojom::kDefaultKeyringId);
+  EXPECT_EQ(account_infos.size(), 4u);
+  for (size_t i = 0; i < account_infos.size(); ++i) {
+    EXPECT_EQ(account_infos[i]->address, saved_addresses()[i]);
+    EXPECT_EQ(account_infos[i]->name, "Account " + std::to_string(i + 1));
+  }
+  // Account 3.
+  EXPECT_EQ(1, observer.AccountsChangedFiredCount());
+  // Requests already in flight when the 8th attempt failed may have been
+  // sent, but no more than that.
+  ASSERT_GE(requested_addresses.size(), 8u);
+  EXPECT_LE(requested_addresses.size(), 8u + 4u);
+  EXPECT_THAT(requested_addresses,
+              ElementsAreArray(&saved_addresses()[1],
+                               requested_addresses.size()));
+}
+
 }  // namespace brave_wallet
@@ -120,7 +120,7 @@ KeyedService* TxServiceFactory::BuildServiceInstanceFor(
     content::BrowserContext* context) const {
   return new TxService(JsonRpcServiceFactory::GetServiceForContext(context),
                        KeyringServiceFactory::GetServiceForContext(context),
-                       user_prefs::UserPrefs::Get(context));
+                       user_prefs::UserPrefs::Get(context), context->GetPath());
 }
 
 content::BrowserContext* TxServiceFactory::GetBrowserContextToUse(
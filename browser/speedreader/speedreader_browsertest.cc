@@ -4,13 +4,19 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "base/bind.h"
+#include "base/files/file_util.h"
 #include "base/path_service.h"
 #include "base/run_loop.h"
+#include "base/test/metrics/histogram_tester.h"
+#include "base/threading/thread_restrictions.h"
 #include "brave/app/brave_command_ids.h"
+#include "brave/browser/brave_browser_process.h"
 #include "brave/browser/speedreader/speedreader_service_factory.h"
 #include "brave/browser/speedreader/speedreader_tab_helper.h"
 #include "brave/common/brave_paths.h"
 #include "brave/components/speedreader/features.h"
+#include "brave/components/speedreader/rust/ffi/speedreader.h"
+#include "brave/components/speedreader/speedreader_rewriter_service.h"
 #include "brave/components/speedreader/speedreader_service.h"
 #include "brave/components/speedreader/speedreader_util.h"
 #include "chrome/browser/profiles/keep_alive/profile_keep_alive_types.h"
@@ -45,6 +51,12 @@ constexpr char kSpeedreaderToggleUMAHistogramName[] =
 constexpr char kSpeedreaderEnabledUMAHistogramName[] =
     "Brave.SpeedReader.Enabled";
 
+constexpr char kSpeedreaderDistillUMAHistogramName[] =
+    "Brave.Speedreader.Distill";
+
+constexpr char kSpeedreaderFirstReadToDistillCompleteUMAHistogramName[] =
+    "Brave.Speedreader.FirstReadToDistillComplete";
+
 class SpeedReaderBrowserTest : public InProcessBrowserTest {
  public:
   SpeedReaderBrowserTest()
@@ -319,3 +331,69 @@ IN_PROC_BROWSER_TEST_F(SpeedReaderBrowserTest, ReloadContent) {
   EXPECT_EQ(speedreader::DistillState::kSpeedreaderOnDisabledPage,
             tab_helper_2->PageDistillState());
 }
+
+class SpeedReaderStreamingBrowserTest
+    : public SpeedReaderBrowserTest,
+      public testing::WithParamInterface<bool> {
+ public:
+  SpeedReaderStreamingBrowserTest() {
+    feature_list_.Reset();
+    feature_list_.InitAndEnableFeatureWithParameters(
+        speedreader::kSpeedreaderFeature,
+        {{"streaming", GetParam() ? "true" : "false"}});
+  }
+
+  // Distills the readable test page as a whole, as the loader does when it
+  // is not streaming.
+  std::string DistillReadablePage() {
+    base::FilePath test_data_dir;
+    base::PathService::Get(brave::DIR_TEST_DATA, &test_data_dir);
+    std::string page;
+    {
+      base::ScopedAllowBlockingForTesting allow_blocking;
+      EXPECT_TRUE(base::ReadFileToString(
+          test_data_dir.AppendASCII("articles/guardian.html"), &page));
+    }
+
+    auto* rewriter_service =
+        g_brave_browser_process->speedreader_rewriter_service();
+    auto rewriter = rewriter_service->MakeRewriter(
+        https_server_.GetURL(kTestHost, kTestPageReadable));
+    EXPECT_EQ(0, rewriter->Write(page.c_str(), page.length()));
+    rewriter->End();
+    return rewriter_service->GetContentStylesheet() + rewriter->GetOutput();
+  }
+};
+
+IN_PROC_BROWSER_TEST_P(SpeedReaderStreamingBrowserTest, DistillsLikeWholeBody) {
+  base::HistogramTester tester;
+  ToggleSpeedreader();
+  NavigateToPageSynchronously(kTestPageReadable);
+  EXPECT_TRUE(
+      speedreader::PageStateIsDistilled(tab_helper()->PageDistillState()));
+  tester.ExpectTotalCount(kSpeedreaderDistillUMAHistogramName, 1);
+  tester.ExpectTotalCount(
+      kSpeedreaderFirstReadToDistillCompleteUMAHistogramName, 1);
+
+  const std::string distilled_body =
+      content::EvalJs(ActiveWebContents(), "document.body.innerHTML")
+          .ExtractString();
+
+  // Parse the page distilled as a whole into a blank tab, so that both
+  // documents are serialized the same way.
+  ASSERT_TRUE(ui_test_utils::NavigateToURLWithDisposition(
+      browser(), GURL("about:blank"),
+      WindowOpenDisposition::NEW_FOREGROUND_TAB,
+      ui_test_utils::BROWSER_TEST_WAIT_FOR_LOAD_STOP));
+  ASSERT_TRUE(content::ExecJs(
+      ActiveWebContents(),
+      content::JsReplace("document.open(); document.write($1); "
+                         "document.close();",
+                         DistillReadablePage())));
+  EXPECT_EQ(distilled_body,
+            content::EvalJs(ActiveWebContents(), "document.body.innerHTML"));
+}
+
+INSTANTIATE_TEST_SUITE_P(All,
+                         SpeedReaderStreamingBrowserTest,
+                         testing::Bool());
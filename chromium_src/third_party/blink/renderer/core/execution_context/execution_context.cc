@@ -35,26 +35,11 @@ inline uint64_t lfsr_next(uint64_t v) {
   return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
 }
 
-float Identity(float value, size_t index) {
-  return value;
-}
-
-float ConstantMultiplier(double fudge_factor, float value, size_t index) {
-  return value * fudge_factor;
-}
-
-float PseudoRandomSequence(uint64_t seed, float value, size_t index) {
-  static uint64_t v;
+// Maps the next value of the LFSR to a pseudo-random float between 0 and 0.1
+inline float NextPseudoRandomSample(uint64_t* v) {
   const double maxUInt64AsDouble = UINT64_MAX;
-  if (index == 0) {
-    // start of loop, reset to initial seed which was passed in and is based on
-    // the domain key
-    v = seed;
-  }
-  // get next value in PRNG sequence
-  v = lfsr_next(v);
-  // return pseudo-random float between 0 and 0.1
-  return (v / maxUInt64AsDouble) / 10;
+  *v = lfsr_next(*v);
+  return (*v / maxUInt64AsDouble) / 10;
 }
 
 }  // namespace
@@ -181,7 +166,48 @@ void BraveSessionCache::Init() {
   RegisterAllowFontFamilyCallback(base::BindRepeating(&brave::AllowFontFamily));
 }
 
-AudioFarblingCallback BraveSessionCache::GetAudioFarblingCallback(
+// static
+AudioFarblingHelper AudioFarblingHelper::Balanced(double fudge_factor) {
+  return AudioFarblingHelper(false, fudge_factor, 0);
+}
+
+// static
+AudioFarblingHelper AudioFarblingHelper::Maximum(uint64_t seed) {
+  return AudioFarblingHelper(true, 1.0, seed);
+}
+
+AudioFarblingHelper::AudioFarblingHelper(bool is_maximum,
+                                         double fudge_factor,
+                                         uint64_t seed)
+    : is_maximum_(is_maximum), fudge_factor_(fudge_factor), seed_(seed) {}
+
+void AudioFarblingHelper::FarbleAudioChannel(base::span<float> data) const {
+  float* samples = data.data();
+  const size_t count = data.size();
+  if (is_maximum_) {
+    // The sequence restarts from the seed for every buffer
+    uint64_t v = seed_;
+    for (size_t i = 0; i < count; ++i)
+      samples[i] = NextPseudoRandomSample(&v);
+    return;
+  }
+  // A plain loop over the buffer, which the compiler vectorizes
+  const double fudge_factor = fudge_factor_;
+  for (size_t i = 0; i < count; ++i)
+    samples[i] = samples[i] * fudge_factor;
+}
+
+float AudioFarblingHelper::FarbleSample(float value,
+                                        size_t index,
+                                        uint64_t* state) const {
+  if (!is_maximum_)
+    return value * fudge_factor_;
+  if (index == 0)
+    *state = seed_;
+  return NextPseudoRandomSample(state);
+}
+
+absl::optional<AudioFarblingHelper> BraveSessionCache::GetAudioFarblingHelper(
     blink::WebContentSettingsClient* settings) {
   if (farbling_enabled_ && settings) {
     switch (settings->GetBraveFarblingLevel()) {
@@ -194,15 +220,15 @@ AudioFarblingCallback BraveSessionCache::GetAudioFarblingCallback(
         double fudge_factor = 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
         VLOG(1) << "audio fudge factor (based on session token) = "
                 << fudge_factor;
-        return base::BindRepeating(&ConstantMultiplier, fudge_factor);
+        return AudioFarblingHelper::Balanced(fudge_factor);
       }
       case BraveFarblingLevel::MAXIMUM: {
         uint64_t seed = *reinterpret_cast<uint64_t*>(domain_key_);
-        return base::BindRepeating(&PseudoRandomSequence, seed);
+        return AudioFarblingHelper::Maximum(seed);
       }
     }
   }
-  return base::BindRepeating(&Identity);
+  return absl::nullopt;
 }
 
 void BraveSessionCache::PerturbPixels(blink::WebContentSettingsClient* settings,
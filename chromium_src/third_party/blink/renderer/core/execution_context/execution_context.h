@@ -7,9 +7,11 @@
 #define BRAVE_CHROMIUM_SRC_THIRD_PARTY_BLINK_RENDERER_CORE_EXECUTION_CONTEXT_EXECUTION_CONTEXT_H_
 
 #include "base/callback.h"
+#include "base/containers/span.h"
 #include "brave/third_party/blink/renderer/brave_farbling_constants.h"
 #include "src/third_party/blink/renderer/core/execution_context/execution_context.h"
 #include "third_party/abseil-cpp/absl/random/random.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
 
@@ -25,7 +27,31 @@ using blink::Supplement;
 namespace brave {
 
 typedef absl::randen_engine<uint64_t> FarblingPRNG;
-typedef base::RepeatingCallback<float(float, size_t)> AudioFarblingCallback;
+
+// Farbles web audio data. A helper holds no state between buffers, so copies
+// of it may be used from any number of audio threads at once.
+class CORE_EXPORT AudioFarblingHelper {
+ public:
+  // Scales every sample by |fudge_factor|.
+  static AudioFarblingHelper Balanced(double fudge_factor);
+  // Replaces every sample with noise from a sequence seeded with |seed|.
+  static AudioFarblingHelper Maximum(uint64_t seed);
+
+  // Farbles a whole buffer in place, as samples 0 to data.size() - 1.
+  void FarbleAudioChannel(base::span<float> data) const;
+
+  // Farbles the sample at |index| for callers which can only handle one sample
+  // at a time. Samples must be passed in ascending order starting from 0, with
+  // the same |state| for the whole buffer.
+  float FarbleSample(float value, size_t index, uint64_t* state) const;
+
+ private:
+  AudioFarblingHelper(bool is_maximum, double fudge_factor, uint64_t seed);
+
+  bool is_maximum_;
+  double fudge_factor_;
+  uint64_t seed_;
+};
 
 CORE_EXPORT blink::WebContentSettingsClient* GetContentSettingsClientFor(
     ExecutionContext* context);
@@ -48,7 +74,8 @@ class CORE_EXPORT BraveSessionCache final
   static BraveSessionCache& From(ExecutionContext&);
   static void Init();
 
-  AudioFarblingCallback GetAudioFarblingCallback(
+  // Returns absl::nullopt if audio shouldn't be farbled.
+  absl::optional<AudioFarblingHelper> GetAudioFarblingHelper(
       blink::WebContentSettingsClient* settings);
   void PerturbPixels(blink::WebContentSettingsClient* settings,
                      const unsigned char* data,
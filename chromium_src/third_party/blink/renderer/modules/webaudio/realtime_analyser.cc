@@ -3,24 +3,30 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
-#define BRAVE_REALTIMEANALYSER_CONVERTFLOATTODB                       \
-  if (audio_farbling_callback_) {                                     \
-    destination[i] = audio_farbling_callback_.Run(destination[i], i); \
+// The analyser's loops farble one sample at a time, mid-computation, so these
+// use FarbleSample rather than farbling a whole buffer.
+#define BRAVE_REALTIMEANALYSER_CONVERTFLOATTODB            \
+  if (audio_farbling_helper_) {                            \
+    destination[i] = audio_farbling_helper_->FarbleSample( \
+        destination[i], i, &audio_farbling_state_);        \
   }
 
-#define BRAVE_REALTIMEANALYSER_CONVERTTOBYTEDATA                  \
-  if (audio_farbling_callback_) {                                 \
-    scaled_value = audio_farbling_callback_.Run(scaled_value, i); \
+#define BRAVE_REALTIMEANALYSER_CONVERTTOBYTEDATA         \
+  if (audio_farbling_helper_) {                          \
+    scaled_value = audio_farbling_helper_->FarbleSample( \
+        scaled_value, i, &audio_farbling_state_);        \
   }
 
-#define BRAVE_REALTIMEANALYSER_GETFLOATTIMEDOMAINDATA        \
-  if (audio_farbling_callback_) {                            \
-    destination[i] = audio_farbling_callback_.Run(value, i); \
+#define BRAVE_REALTIMEANALYSER_GETFLOATTIMEDOMAINDATA      \
+  if (audio_farbling_helper_) {                            \
+    destination[i] = audio_farbling_helper_->FarbleSample( \
+        value, i, &audio_farbling_state_);                 \
   }
 
-#define BRAVE_REALTIMEANALYSER_GETBYTETIMEDOMAINDATA \
-  if (audio_farbling_callback_) {                    \
-    value = audio_farbling_callback_.Run(value, i);  \
+#define BRAVE_REALTIMEANALYSER_GETBYTETIMEDOMAINDATA  \
+  if (audio_farbling_helper_) {                       \
+    value = audio_farbling_helper_->FarbleSample(     \
+        value, i, &audio_farbling_state_);            \
   }
 
 #include "src/third_party/blink/renderer/modules/webaudio/realtime_analyser.cc"
@@ -6,10 +6,12 @@
 #ifndef BRAVE_CHROMIUM_SRC_THIRD_PARTY_BLINK_RENDERER_MODULES_WEBAUDIO_REALTIME_ANALYSER_H_
 #define BRAVE_CHROMIUM_SRC_THIRD_PARTY_BLINK_RENDERER_MODULES_WEBAUDIO_REALTIME_ANALYSER_H_
 
-#include "base/callback.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/blink/renderer/core/execution_context/execution_context.h"
 
-#define BRAVE_REALTIMEANALYSER_H \
-  base::RepeatingCallback<float(float, size_t)> audio_farbling_callback_;
+#define BRAVE_REALTIMEANALYSER_H                                     \
+  absl::optional<brave::AudioFarblingHelper> audio_farbling_helper_; \
+  uint64_t audio_farbling_state_ = 0;
 
 #include "src/third_party/blink/renderer/modules/webaudio/realtime_analyser.h"
 
@@ -6,6 +6,8 @@
 #include <assert.h>
 #include <cstring>
 #include <iostream>
+#include <string>
+#include <vector>
 #include "wrapper.h"
 
 size_t num_passed = 0;
@@ -316,6 +318,31 @@ void TestUrlCosmetics() {
   assert(bad_b_resources == bad_b_result);
 }
 
+void TestTypedUrlCosmetics() {
+  adblock::Engine engine(
+      "a.com###element\n"
+      "##.block\n"
+      "a.com#@#.block\n"
+      "##a[href=\"b.com\"]\n"
+      "a.*##div:style(background: #fff)\n");
+
+  adblock::UrlCosmeticResources a_resources =
+      engine.getUrlCosmeticResources("https://a.com");
+  assert(a_resources.hide_selectors.size() == 2);
+  assert(a_resources.style_selectors.size() == 1);
+  assert(a_resources.style_selectors["div"] ==
+         std::vector<std::string>{"background: #fff"});
+  assert(a_resources.exceptions == std::vector<std::string>{".block"});
+  assert(a_resources.injected_script.empty());
+  assert(!a_resources.generichide);
+
+  adblock::UrlCosmeticResources bad_resources =
+      engine.getUrlCosmeticResources("a.com");
+  assert(bad_resources.hide_selectors.empty());
+  assert(bad_resources.style_selectors.empty());
+  assert(bad_resources.exceptions.empty());
+}
+
 void TestSubdomainUrlCosmetics() {
   adblock::Engine engine(
       "a.co.uk##.element\n"
@@ -435,6 +462,7 @@ int main() {
   TestException();
   TestClassId();
   TestUrlCosmetics();
+  TestTypedUrlCosmetics();
   TestSubdomainUrlCosmetics();
   TestGenerichide();
   TestCosmeticScriptletResources();
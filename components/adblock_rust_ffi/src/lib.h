@@ -23,6 +23,35 @@ typedef struct C_Engine C_Engine;
  */
 typedef void (*C_DomainResolverCallback)(const char*, uint32_t*, uint32_t*);
 
+/**
+ * A list of strings, owned by the library.
+ */
+typedef struct C_StringList {
+  char** data;
+  size_t size;
+} C_StringList;
+
+/**
+ * A selector along with the styles to apply to the elements it matches.
+ */
+typedef struct C_StyleSelector {
+  char* selector;
+  struct C_StringList styles;
+} C_StyleSelector;
+
+/**
+ * Cosmetic filtering resources specific to a url, see
+ * `engine_get_url_cosmetic_resources`.
+ */
+typedef struct C_UrlCosmeticResources {
+  struct C_StringList hide_selectors;
+  struct C_StyleSelector* style_selectors;
+  size_t style_selectors_size;
+  struct C_StringList exceptions;
+  char* injected_script;
+  bool generichide;
+} C_UrlCosmeticResources;
+
 /**
  * Passes a callback to the adblock library, allowing it to be used for domain
  * resolution.
@@ -120,6 +149,20 @@ void c_char_buffer_destroy(char* s);
  */
 char* engine_url_cosmetic_resources(struct C_Engine* engine, const char* url);
 
+/**
+ * Returns a set of cosmetic filtering resources specific to the given url,
+ * without going through JSON. Destroy it with `url_cosmetic_resources_destroy`
+ * once you are done with it.
+ */
+struct C_UrlCosmeticResources* engine_get_url_cosmetic_resources(
+    struct C_Engine* engine,
+    const char* url);
+
+/**
+ * Destroy a `UrlCosmeticResources` once you are done with it.
+ */
+void url_cosmetic_resources_destroy(struct C_UrlCosmeticResources* resources);
+
 /**
  * Returns a stylesheet containing all generic cosmetic rules that begin with
  * any of the provided class and id selectors
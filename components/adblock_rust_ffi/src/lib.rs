@@ -258,6 +258,99 @@ pub unsafe extern "C" fn engine_url_cosmetic_resources(
     .into_raw()
 }
 
+/// A list of strings, owned by the library.
+#[repr(C)]
+pub struct StringList {
+    data: *mut *mut c_char,
+    size: size_t,
+}
+
+impl StringList {
+    fn new<I: IntoIterator<Item = String>>(strings: I) -> Self {
+        let data: Box<[*mut c_char]> = strings
+            .into_iter()
+            .map(|s| CString::new(s).unwrap_or_default().into_raw())
+            .collect();
+        let size = data.len();
+        StringList { data: Box::into_raw(data) as *mut *mut c_char, size }
+    }
+
+    unsafe fn destroy(self) {
+        let data = Box::from_raw(std::slice::from_raw_parts_mut(self.data, self.size));
+        for s in data.iter() {
+            drop(CString::from_raw(*s));
+        }
+    }
+}
+
+/// A selector along with the styles to apply to the elements it matches.
+#[repr(C)]
+pub struct StyleSelector {
+    selector: *mut c_char,
+    styles: StringList,
+}
+
+/// Cosmetic filtering resources specific to a url, see `engine_get_url_cosmetic_resources`.
+#[repr(C)]
+pub struct UrlCosmeticResources {
+    hide_selectors: StringList,
+    style_selectors: *mut StyleSelector,
+    style_selectors_size: size_t,
+    exceptions: StringList,
+    injected_script: *mut c_char,
+    generichide: bool,
+}
+
+/// Returns a set of cosmetic filtering resources specific to the given url, without going through
+/// JSON. Destroy it with `url_cosmetic_resources_destroy` once you are done with it.
+#[no_mangle]
+pub unsafe extern "C" fn engine_get_url_cosmetic_resources(
+    engine: *mut Engine,
+    url: *const c_char,
+) -> *mut UrlCosmeticResources {
+    let url = CStr::from_ptr(url).to_str().unwrap();
+    assert!(!engine.is_null());
+    let engine = Box::leak(Box::from_raw(engine));
+    let resources = engine.url_cosmetic_resources(url);
+    let style_selectors: Box<[StyleSelector]> = resources
+        .style_selectors
+        .into_iter()
+        .map(|(selector, styles)| StyleSelector {
+            selector: CString::new(selector).unwrap_or_default().into_raw(),
+            styles: StringList::new(styles),
+        })
+        .collect();
+    let style_selectors_size = style_selectors.len();
+    Box::into_raw(Box::new(UrlCosmeticResources {
+        hide_selectors: StringList::new(resources.hide_selectors),
+        style_selectors: Box::into_raw(style_selectors) as *mut StyleSelector,
+        style_selectors_size,
+        exceptions: StringList::new(resources.exceptions),
+        injected_script: CString::new(resources.injected_script).unwrap_or_default().into_raw(),
+        generichide: resources.generichide,
+    }))
+}
+
+/// Destroy a `UrlCosmeticResources` once you are done with it.
+#[no_mangle]
+pub unsafe extern "C" fn url_cosmetic_resources_destroy(resources: *mut UrlCosmeticResources) {
+    if resources.is_null() {
+        return;
+    }
+    let resources = Box::from_raw(resources);
+    resources.hide_selectors.destroy();
+    let style_selectors = Box::from_raw(std::slice::from_raw_parts_mut(
+        resources.style_selectors,
+        resources.style_selectors_size,
+    ));
+    for style_selector in style_selectors.into_vec() {
+        drop(CString::from_raw(style_selector.selector));
+        style_selector.styles.destroy();
+    }
+    resources.exceptions.destroy();
+    drop(CString::from_raw(resources.injected_script));
+}
+
 /// Returns a stylesheet containing all generic cosmetic rules that begin with any of the provided class and id selectors
 ///
 /// The leading '.' or '#' character should not be provided
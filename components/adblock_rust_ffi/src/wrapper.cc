@@ -12,6 +12,19 @@ extern "C" {
 
 namespace adblock {
 
+namespace {
+
+std::vector<std::string> ToStringVector(const C_StringList& list) {
+  std::vector<std::string> strings;
+  strings.reserve(list.size);
+  for (size_t i = 0; i < list.size; i++) {
+    strings.push_back(list.data[i]);
+  }
+  return strings;
+}
+
+}  // namespace
+
 bool SetDomainResolver(DomainResolverCallback resolver) {
   return set_domain_resolver(resolver);
 }
@@ -40,6 +53,17 @@ FilterList::FilterList(const FilterList& other) = default;
 
 FilterList::~FilterList() {}
 
+UrlCosmeticResources::UrlCosmeticResources() = default;
+UrlCosmeticResources::UrlCosmeticResources(const UrlCosmeticResources& other) =
+    default;
+UrlCosmeticResources::UrlCosmeticResources(UrlCosmeticResources&& other) =
+    default;
+UrlCosmeticResources& UrlCosmeticResources::operator=(
+    const UrlCosmeticResources& other) = default;
+UrlCosmeticResources& UrlCosmeticResources::operator=(
+    UrlCosmeticResources&& other) = default;
+UrlCosmeticResources::~UrlCosmeticResources() = default;
+
 Engine::Engine() : raw(engine_create("")) {}
 
 Engine::Engine(const std::string& rules) : raw(engine_create(rules.c_str())) {}
@@ -116,6 +140,25 @@ const std::string Engine::urlCosmeticResources(const std::string& url) {
   return resources_json;
 }
 
+UrlCosmeticResources Engine::getUrlCosmeticResources(const std::string& url) {
+  C_UrlCosmeticResources* resources_raw =
+      engine_get_url_cosmetic_resources(raw, url.c_str());
+
+  UrlCosmeticResources resources;
+  resources.hide_selectors = ToStringVector(resources_raw->hide_selectors);
+  for (size_t i = 0; i < resources_raw->style_selectors_size; i++) {
+    const C_StyleSelector& style_selector = resources_raw->style_selectors[i];
+    resources.style_selectors[style_selector.selector] =
+        ToStringVector(style_selector.styles);
+  }
+  resources.exceptions = ToStringVector(resources_raw->exceptions);
+  resources.injected_script = resources_raw->injected_script;
+  resources.generichide = resources_raw->generichide;
+
+  url_cosmetic_resources_destroy(resources_raw);
+  return resources;
+}
+
 const std::string Engine::hiddenClassIdSelectors(
     const std::vector<std::string>& classes,
     const std::vector<std::string>& ids,
@@ -5,6 +5,7 @@
 
 #ifndef BRAVE_COMPONENTS_ADBLOCK_RUST_FFI_SRC_WRAPPER_H_
 #define BRAVE_COMPONENTS_ADBLOCK_RUST_FFI_SRC_WRAPPER_H_
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -66,6 +67,22 @@ class ADBLOCK_EXPORT FilterList {
   static std::vector<FilterList> regional_list;
 };
 
+struct ADBLOCK_EXPORT UrlCosmeticResources {
+  UrlCosmeticResources();
+  UrlCosmeticResources(const UrlCosmeticResources& other);
+  UrlCosmeticResources(UrlCosmeticResources&& other);
+  UrlCosmeticResources& operator=(const UrlCosmeticResources& other);
+  UrlCosmeticResources& operator=(UrlCosmeticResources&& other);
+  ~UrlCosmeticResources();
+
+  std::vector<std::string> hide_selectors;
+  // Styles to apply, by selector
+  std::map<std::string, std::vector<std::string>> style_selectors;
+  std::vector<std::string> exceptions;
+  std::string injected_script;
+  bool generichide = false;
+};
+
 class ADBLOCK_EXPORT Engine {
  public:
   Engine();
@@ -94,6 +111,7 @@ class ADBLOCK_EXPORT Engine {
   void removeTag(const std::string& tag);
   bool tagExists(const std::string& tag);
   const std::string urlCosmeticResources(const std::string& url);
+  UrlCosmeticResources getUrlCosmeticResources(const std::string& url);
   const std::string hiddenClassIdSelectors(
       const std::vector<std::string>& classes,
       const std::vector<std::string>& ids,
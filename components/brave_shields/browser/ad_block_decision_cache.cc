@@ -0,0 +1,88 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_decision_cache.h"
+
+#include <atomic>
+
+namespace brave_shields {
+
+namespace {
+
+std::atomic<uint64_t> g_generation{0};
+
+}  // namespace
+
+// static
+AdBlockDecisionCache::Key AdBlockDecisionCache::MakeKey(
+    const std::string& url,
+    blink::mojom::ResourceType resource_type,
+    const std::string& tab_host,
+    bool aggressive_blocking,
+    bool did_match_rule,
+    bool did_match_exception,
+    bool did_match_important) {
+  return std::make_tuple(url, resource_type, tab_host, aggressive_blocking,
+                         did_match_rule, did_match_exception,
+                         did_match_important);
+}
+
+// static
+void AdBlockDecisionCache::Invalidate() {
+  g_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+// static
+uint64_t AdBlockDecisionCache::GetGeneration() {
+  return g_generation.load(std::memory_order_relaxed);
+}
+
+AdBlockDecisionCache::AdBlockDecisionCache(size_t max_size)
+    : decisions_(max_size), generation_(GetGeneration()) {
+  DETACH_FROM_SEQUENCE(sequence_checker_);
+}
+
+AdBlockDecisionCache::~AdBlockDecisionCache() = default;
+
+bool AdBlockDecisionCache::Get(const Key& key, Decision* decision) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  DCHECK(decision);
+
+  MaybeClear();
+
+  auto it = decisions_.Get(key);
+  if (it == decisions_.end()) {
+    return false;
+  }
+
+  *decision = it->second;
+  return true;
+}
+
+void AdBlockDecisionCache::Put(const Key& key,
+                               const Decision& decision,
+                               uint64_t generation) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  MaybeClear();
+
+  if (generation != generation_) {
+    return;
+  }
+
+  decisions_.Put(key, decision);
+}
+
+void AdBlockDecisionCache::MaybeClear() {
+  const uint64_t generation = GetGeneration();
+  if (generation == generation_) {
+    return;
+  }
+
+  decisions_.Clear();
+  generation_ = generation;
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,77 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_DECISION_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_DECISION_CACHE_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <tuple>
+
+#include "base/containers/lru_cache.h"
+#include "base/sequence_checker.h"
+#include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
+
+namespace brave_shields {
+
+// Caches the merged result of AdBlockService::ShouldStartRequest across all
+// engines. Any change to an engine or to the set of enabled engines must call
+// |Invalidate|, which drops every cached decision.
+class AdBlockDecisionCache {
+ public:
+  struct Decision {
+    bool did_match_rule = false;
+    bool did_match_exception = false;
+    bool did_match_important = false;
+    // Empty unless an engine returned a redirect
+    std::string mock_data_url;
+  };
+
+  // The request together with the match flags passed in by the caller, as
+  // engines skip checks based on earlier matches.
+  using Key = std::tuple<std::string,
+                         blink::mojom::ResourceType,
+                         std::string,
+                         bool,
+                         bool,
+                         bool,
+                         bool>;
+
+  static Key MakeKey(const std::string& url,
+                     blink::mojom::ResourceType resource_type,
+                     const std::string& tab_host,
+                     bool aggressive_blocking,
+                     bool did_match_rule,
+                     bool did_match_exception,
+                     bool did_match_important);
+
+  // Can be called from any sequence.
+  static void Invalidate();
+  static uint64_t GetGeneration();
+
+  explicit AdBlockDecisionCache(size_t max_size);
+  AdBlockDecisionCache(const AdBlockDecisionCache&) = delete;
+  AdBlockDecisionCache& operator=(const AdBlockDecisionCache&) = delete;
+  ~AdBlockDecisionCache();
+
+  bool Get(const Key& key, Decision* decision);
+
+  // |generation| is the value of |GetGeneration| from before the decision was
+  // computed, so decisions racing with an invalidation are not cached.
+  void Put(const Key& key, const Decision& decision, uint64_t generation);
+
+ private:
+  void MaybeClear();
+
+  base::LRUCache<Key, Decision> decisions_;
+  uint64_t generation_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_DECISION_CACHE_H_
@@ -0,0 +1,100 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_decision_cache.h"
+
+#include <string>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+using blink::mojom::ResourceType;
+using brave_shields::AdBlockDecisionCache;
+
+namespace {
+
+AdBlockDecisionCache::Key MakeKey(const std::string& url) {
+  return AdBlockDecisionCache::MakeKey(url, ResourceType::kScript,
+                                       "example.com", false, false, false,
+                                       false);
+}
+
+AdBlockDecisionCache::Decision MakeDecision(const std::string& mock_data_url) {
+  AdBlockDecisionCache::Decision decision;
+  decision.did_match_rule = true;
+  decision.mock_data_url = mock_data_url;
+  return decision;
+}
+
+}  // namespace
+
+TEST(AdBlockDecisionCacheTest, GetAndPut) {
+  AdBlockDecisionCache cache(3);
+
+  AdBlockDecisionCache::Decision decision;
+  ASSERT_FALSE(cache.Get(MakeKey("https://a.com/ad.js"), &decision));
+
+  cache.Put(MakeKey("https://a.com/ad.js"), MakeDecision("data:a"),
+            AdBlockDecisionCache::GetGeneration());
+  ASSERT_TRUE(cache.Get(MakeKey("https://a.com/ad.js"), &decision));
+  EXPECT_TRUE(decision.did_match_rule);
+  EXPECT_FALSE(decision.did_match_exception);
+  EXPECT_FALSE(decision.did_match_important);
+  EXPECT_EQ("data:a", decision.mock_data_url);
+
+  // The incoming match flags are part of the key.
+  EXPECT_FALSE(cache.Get(
+      AdBlockDecisionCache::MakeKey("https://a.com/ad.js",
+                                    ResourceType::kScript, "example.com",
+                                    false, true, false, false),
+      &decision));
+  EXPECT_FALSE(cache.Get(
+      AdBlockDecisionCache::MakeKey("https://a.com/ad.js",
+                                    ResourceType::kScript, "example.com", true,
+                                    false, false, false),
+      &decision));
+}
+
+TEST(AdBlockDecisionCacheTest, EvictsLeastRecentlyUsed) {
+  AdBlockDecisionCache cache(3);
+  const uint64_t generation = AdBlockDecisionCache::GetGeneration();
+
+  cache.Put(MakeKey("https://a.com/"), MakeDecision("data:a"), generation);
+  cache.Put(MakeKey("https://b.com/"), MakeDecision("data:b"), generation);
+  cache.Put(MakeKey("https://c.com/"), MakeDecision("data:c"), generation);
+
+  AdBlockDecisionCache::Decision decision;
+  // a.com just became MRU, so adding a new decision should evict b.com.
+  ASSERT_TRUE(cache.Get(MakeKey("https://a.com/"), &decision));
+  cache.Put(MakeKey("https://d.com/"), MakeDecision("data:d"), generation);
+
+  EXPECT_FALSE(cache.Get(MakeKey("https://b.com/"), &decision));
+  EXPECT_TRUE(cache.Get(MakeKey("https://a.com/"), &decision));
+  EXPECT_TRUE(cache.Get(MakeKey("https://c.com/"), &decision));
+  EXPECT_TRUE(cache.Get(MakeKey("https://d.com/"), &decision));
+}
+
+TEST(AdBlockDecisionCacheTest, Invalidate) {
+  AdBlockDecisionCache cache(3);
+
+  cache.Put(MakeKey("https://a.com/"), MakeDecision("data:a"),
+            AdBlockDecisionCache::GetGeneration());
+
+  AdBlockDecisionCache::Invalidate();
+
+  AdBlockDecisionCache::Decision decision;
+  EXPECT_FALSE(cache.Get(MakeKey("https://a.com/"), &decision));
+}
+
+TEST(AdBlockDecisionCacheTest, IgnoresStaleDecision) {
+  AdBlockDecisionCache cache(3);
+
+  // A decision computed before an engine changed must not be cached.
+  const uint64_t generation = AdBlockDecisionCache::GetGeneration();
+  AdBlockDecisionCache::Invalidate();
+  cache.Put(MakeKey("https://a.com/"), MakeDecision("data:a"), generation);
+
+  AdBlockDecisionCache::Decision decision;
+  EXPECT_FALSE(cache.Get(MakeKey("https://a.com/"), &decision));
+}
@@ -18,6 +18,7 @@
 #include "base/strings/utf_string_conversions.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/browser/ad_block_decision_cache.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -97,6 +98,24 @@ std::string ResourceTypeToString(blink::mojom::ResourceType resource_type) {
 
 namespace brave_shields {
 
+AdBlockRequestContext::AdBlockRequestContext(
+    const GURL& url,
+    blink::mojom::ResourceType resource_type,
+    const std::string& tab_host)
+    : url(url.spec()),
+      host(url.host()),
+      tab_host(tab_host),
+      resource_type(ResourceTypeToString(resource_type)),
+      // Determine third-party here so the library doesn't need to figure it
+      // out. CreateFromNormalizedTuple is needed because SameDomainOrHost
+      // needs a URL or origin and not a string to a host name.
+      is_third_party(!SameDomainOrHost(
+          url,
+          url::Origin::CreateFromNormalizedTuple("https", tab_host.c_str(), 80),
+          INCLUDE_PRIVATE_REGISTRIES)) {}
+
+AdBlockRequestContext::~AdBlockRequestContext() = default;
+
 AdBlockEngine::AdBlockEngine() : ad_block_client_(new adblock::Engine()) {}
 
 AdBlockEngine::~AdBlockEngine() {}
@@ -109,22 +128,20 @@ void AdBlockEngine::ShouldStartRequest(const GURL& url,
                                        bool* did_match_exception,
                                        bool* did_match_important,
                                        std::string* mock_data_url) {
-  // Determine third-party here so the library doesn't need to figure it out.
-  // CreateFromNormalizedTuple is needed because SameDomainOrHost needs
-  // a URL or origin and not a string to a host name.
-  bool is_third_party = !SameDomainOrHost(
-      url,
-      url::Origin::CreateFromNormalizedTuple("https", tab_host.c_str(), 80),
-      INCLUDE_PRIVATE_REGISTRIES);
-  ad_block_client_->matches(url.spec(), url.host(), tab_host, is_third_party,
-                            ResourceTypeToString(resource_type), did_match_rule,
-                            did_match_exception, did_match_important,
-                            mock_data_url);
+  ShouldStartRequest(AdBlockRequestContext(url, resource_type, tab_host),
+                     did_match_rule, did_match_exception, did_match_important,
+                     mock_data_url);
+}
 
-  // LOG(ERROR) << "AdBlockEngine::ShouldStartRequest(), host: "
-  //  << tab_host
-  //  << ", resource type: " << resource_type
-  //  << ", url.spec(): " << url.spec();
+void AdBlockEngine::ShouldStartRequest(const AdBlockRequestContext& request,
+                                       bool* did_match_rule,
+                                       bool* did_match_exception,
+                                       bool* did_match_important,
+                                       std::string* mock_data_url) {
+  ad_block_client_->matches(request.url, request.host, request.tab_host,
+                            request.is_third_party, request.resource_type,
+                            did_match_rule, did_match_exception,
+                            did_match_important, mock_data_url);
 }
 
 absl::optional<std::string> AdBlockEngine::GetCspDirectives(
@@ -150,6 +167,7 @@ absl::optional<std::string> AdBlockEngine::GetCspDirectives(
 }
 
 void AdBlockEngine::EnableTag(const std::string& tag, bool enabled) {
+  AdBlockDecisionCache::Invalidate();
   if (enabled) {
     if (tags_.find(tag) == tags_.end()) {
       ad_block_client_->addTag(tag);
@@ -166,6 +184,7 @@ void AdBlockEngine::EnableTag(const std::string& tag, bool enabled) {
 }
 
 void AdBlockEngine::AddResources(const std::string& resources) {
+  AdBlockDecisionCache::Invalidate();
   ad_block_client_->addResources(resources);
 }
 
@@ -173,9 +192,9 @@ bool AdBlockEngine::TagExists(const std::string& tag) {
   return std::find(tags_.begin(), tags_.end(), tag) != tags_.end();
 }
 
-absl::optional<base::Value> AdBlockEngine::UrlCosmeticResources(
+adblock::UrlCosmeticResources AdBlockEngine::UrlCosmeticResources(
     const std::string& url) {
-  return base::JSONReader::Read(ad_block_client_->urlCosmeticResources(url));
+  return ad_block_client_->getUrlCosmeticResources(url);
 }
 
 base::Value AdBlockEngine::HiddenClassIdSelectors(
@@ -206,6 +225,7 @@ void AdBlockEngine::UpdateAdBlockClient(
     std::unique_ptr<adblock::Engine> ad_block_client,
     const std::string& resources_json) {
   ad_block_client_ = std::move(ad_block_client);
+  AdBlockDecisionCache::Invalidate();
   AddResources(resources_json);
   AddKnownTagsToAdBlockInstance();
   if (test_observer_) {
@@ -25,6 +25,7 @@ using brave_component_updater::DATFileDataBuffer;
 
 namespace adblock {
 class Engine;
+struct UrlCosmeticResources;
 }
 
 class AdBlockServiceTest;
@@ -34,6 +35,23 @@ class PerfPredictorTabHelperTest;
 
 namespace brave_shields {
 
+// Attributes of a request which are computed once and then shared by every
+// engine which checks the request.
+struct AdBlockRequestContext {
+  AdBlockRequestContext(const GURL& url,
+                        blink::mojom::ResourceType resource_type,
+                        const std::string& tab_host);
+  AdBlockRequestContext(const AdBlockRequestContext&) = delete;
+  AdBlockRequestContext& operator=(const AdBlockRequestContext&) = delete;
+  ~AdBlockRequestContext();
+
+  const std::string url;
+  const std::string host;
+  const std::string tab_host;
+  const std::string resource_type;
+  const bool is_third_party;
+};
+
 // Service managing an adblock engine.
 class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
  public:
@@ -53,6 +71,11 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
                           bool* did_match_exception,
                           bool* did_match_important,
                           std::string* mock_data_url);
+  void ShouldStartRequest(const AdBlockRequestContext& request,
+                          bool* did_match_rule,
+                          bool* did_match_exception,
+                          bool* did_match_important,
+                          std::string* mock_data_url);
   absl::optional<std::string> GetCspDirectives(
       const GURL& url,
       blink::mojom::ResourceType resource_type,
@@ -61,7 +84,7 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
   void EnableTag(const std::string& tag, bool enabled);
   bool TagExists(const std::string& tag);
 
-  absl::optional<base::Value> UrlCosmeticResources(const std::string& url);
+  adblock::UrlCosmeticResources UrlCosmeticResources(const std::string& url);
   base::Value HiddenClassIdSelectors(
       const std::vector<std::string>& classes,
       const std::vector<std::string>& ids,
@@ -14,6 +14,7 @@
 #include "base/task/post_task.h"
 #include "base/values.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "brave/components/brave_shields/browser/ad_block_decision_cache.h"
 #include "brave/components/brave_shields/browser/ad_block_engine.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service_helper.h"
@@ -157,10 +158,7 @@ bool AdBlockRegionalServiceManager::Start() {
 }
 
 void AdBlockRegionalServiceManager::ShouldStartRequest(
-    const GURL& url,
-    blink::mojom::ResourceType resource_type,
-    const std::string& tab_host,
-    bool aggressive_blocking,
+    const AdBlockRequestContext& request,
     bool* did_match_rule,
     bool* did_match_exception,
     bool* did_match_important,
@@ -169,8 +167,8 @@ void AdBlockRegionalServiceManager::ShouldStartRequest(
 
   for (const auto& regional_service : regional_services_) {
     regional_service.second->ShouldStartRequest(
-        url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-        did_match_exception, did_match_important, mock_data_url);
+        request, did_match_rule, did_match_exception, did_match_important,
+        mock_data_url);
     if (did_match_important && *did_match_important) {
       return;
     }
@@ -245,6 +243,7 @@ void AdBlockRegionalServiceManager::EnableFilterList(const std::string& uuid,
     std::move(*it2->second).Delete();
     regional_filters_providers_.erase(it2);
   }
+  AdBlockDecisionCache::Invalidate();
 
   // Update preferences to reflect enabled/disabled state of specified
   // filter list
@@ -254,26 +253,18 @@ void AdBlockRegionalServiceManager::EnableFilterList(const std::string& uuid,
                      weak_factory_.GetWeakPtr(), uuid, enabled));
 }
 
-absl::optional<base::Value> AdBlockRegionalServiceManager::UrlCosmeticResources(
-    const std::string& url) {
+absl::optional<CosmeticResources>
+AdBlockRegionalServiceManager::UrlCosmeticResources(const std::string& url) {
   base::AutoLock lock(regional_services_lock_);
   auto it = regional_services_.begin();
   if (it == regional_services_.end()) {
-    return absl::optional<base::Value>();
+    return absl::nullopt;
   }
-  absl::optional<base::Value> first_value =
-      it->second->UrlCosmeticResources(url);
-
-  for (; it != regional_services_.end(); it++) {
-    absl::optional<base::Value> next_value =
-        it->second->UrlCosmeticResources(url);
-    if (first_value) {
-      if (next_value) {
-        MergeResourcesInto(std::move(*next_value), &*first_value, false);
-      }
-    } else {
-      first_value = std::move(next_value);
-    }
+  CosmeticResources first_value(it->second->UrlCosmeticResources(url));
+
+  for (++it; it != regional_services_.end(); it++) {
+    MergeResourcesInto(CosmeticResources(it->second->UrlCosmeticResources(url)),
+                       &first_value, false);
   }
 
   return first_value;
@@ -22,6 +22,7 @@
 #include "brave/components/brave_shields/browser/ad_block_regional_filters_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_resource_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
+#include "brave/components/brave_shields/browser/ad_block_service_helper.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 #include "url/gurl.h"
@@ -59,10 +60,7 @@ class AdBlockRegionalServiceManager
   const std::vector<adblock::FilterList>& GetRegionalCatalog();
 
   bool Start();
-  void ShouldStartRequest(const GURL& url,
-                          blink::mojom::ResourceType resource_type,
-                          const std::string& tab_host,
-                          bool aggressive_blocking,
+  void ShouldStartRequest(const AdBlockRequestContext& request,
                           bool* did_match_rule,
                           bool* did_match_exception,
                           bool* did_match_important,
@@ -75,7 +73,8 @@ class AdBlockRegionalServiceManager
   void AddResources(const std::string& resources);
   void EnableFilterList(const std::string& uuid, bool enabled);
 
-  absl::optional<base::Value> UrlCosmeticResources(const std::string& url);
+  absl::optional<CosmeticResources> UrlCosmeticResources(
+      const std::string& url);
   base::Value HiddenClassIdSelectors(
       const std::vector<std::string>& classes,
       const std::vector<std::string>& ids,
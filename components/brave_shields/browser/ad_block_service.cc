@@ -14,6 +14,8 @@
 #include "base/files/file_path.h"
 #include "base/logging.h"
 #include "base/memory/ptr_util.h"
+#include "base/metrics/histogram_functions.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/threading/thread_restrictions.h"
@@ -31,14 +33,21 @@
 #include "components/prefs/pref_change_registrar.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
-#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
-#include "url/origin.h"
 
 #define DAT_FILE "rs-ABPFilterParserData.dat"
 
 namespace brave_shields {
 
+namespace {
+
+constexpr size_t kDecisionCacheSize = 1000;
+// Each frame asks for its url's resources on commit, so a handful of entries
+// covers reloads and the subframes of recently visited pages.
+constexpr size_t kCosmeticResourcesCacheSize = 32;
+
+}  // namespace
+
 AdBlockService::SourceProviderObserver::SourceProviderObserver(
     base::WeakPtr<AdBlockEngine> adblock_engine,
     AdBlockFiltersProvider* filters_provider,
@@ -92,37 +101,81 @@ void AdBlockService::ShouldStartRequest(
     bool* did_match_important,
     std::string* mock_data_url) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  DCHECK(did_match_rule);
+  DCHECK(did_match_exception);
+  DCHECK(did_match_important);
+
+  const AdBlockDecisionCache::Key key = AdBlockDecisionCache::MakeKey(
+      url.spec(), resource_type, tab_host, aggressive_blocking,
+      *did_match_rule, *did_match_exception, *did_match_important);
+
+  AdBlockDecisionCache::Decision decision;
+  const bool is_cached = decision_cache_.Get(key, &decision);
+  base::UmaHistogramBoolean("Brave.Adblock.DecisionCacheHit", is_cached);
+  if (!is_cached) {
+    const uint64_t generation = AdBlockDecisionCache::GetGeneration();
+    decision.did_match_rule = *did_match_rule;
+    decision.did_match_exception = *did_match_exception;
+    decision.did_match_important = *did_match_important;
+    ShouldStartRequest(AdBlockRequestContext(url, resource_type, tab_host),
+                       aggressive_blocking, &decision);
+    decision_cache_.Put(key, decision, generation);
+  }
+
+  *did_match_rule = decision.did_match_rule;
+  *did_match_exception = decision.did_match_exception;
+  *did_match_important = decision.did_match_important;
+  if (mock_data_url && !decision.mock_data_url.empty()) {
+    *mock_data_url = decision.mock_data_url;
+  }
+}
+
+void AdBlockService::ShouldStartRequest(
+    const AdBlockRequestContext& request,
+    bool aggressive_blocking,
+    AdBlockDecisionCache::Decision* decision) {
+  DCHECK(decision);
+
   if (aggressive_blocking ||
       base::FeatureList::IsEnabled(
           brave_shields::features::kBraveAdblockDefault1pBlocking) ||
-      !SameDomainOrHost(
-          url, url::Origin::CreateFromNormalizedTuple("https", tab_host, 80),
-          net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES)) {
+      request.is_third_party) {
+    SCOPED_UMA_HISTOGRAM_TIMER_MICROS(
+        "Brave.Adblock.ShouldStartRequest.Default");
     default_service()->ShouldStartRequest(
-        url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-        did_match_exception, did_match_important, mock_data_url);
-    if (did_match_important && *did_match_important) {
+        request, &decision->did_match_rule, &decision->did_match_exception,
+        &decision->did_match_important, &decision->mock_data_url);
+    if (decision->did_match_important) {
       return;
     }
   }
 
-  regional_service_manager()->ShouldStartRequest(
-      url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-      did_match_exception, did_match_important, mock_data_url);
-  if (did_match_important && *did_match_important) {
-    return;
+  {
+    SCOPED_UMA_HISTOGRAM_TIMER_MICROS(
+        "Brave.Adblock.ShouldStartRequest.Regional");
+    regional_service_manager()->ShouldStartRequest(
+        request, &decision->did_match_rule, &decision->did_match_exception,
+        &decision->did_match_important, &decision->mock_data_url);
+    if (decision->did_match_important) {
+      return;
+    }
   }
 
-  subscription_service_manager()->ShouldStartRequest(
-      url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-      did_match_exception, did_match_important, mock_data_url);
-  if (did_match_important && *did_match_important) {
-    return;
+  {
+    SCOPED_UMA_HISTOGRAM_TIMER_MICROS(
+        "Brave.Adblock.ShouldStartRequest.Subscription");
+    subscription_service_manager()->ShouldStartRequest(
+        request, &decision->did_match_rule, &decision->did_match_exception,
+        &decision->did_match_important, &decision->mock_data_url);
+    if (decision->did_match_important) {
+      return;
+    }
   }
 
+  SCOPED_UMA_HISTOGRAM_TIMER_MICROS("Brave.Adblock.ShouldStartRequest.Custom");
   custom_filters_service()->ShouldStartRequest(
-      url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-      did_match_exception, did_match_important, mock_data_url);
+      request, &decision->did_match_rule, &decision->did_match_exception,
+      &decision->did_match_important, &decision->mock_data_url);
 }
 
 absl::optional<std::string> AdBlockService::GetCspDirectives(
@@ -144,37 +197,46 @@ absl::optional<std::string> AdBlockService::GetCspDirectives(
   return csp_directives;
 }
 
-absl::optional<base::Value> AdBlockService::UrlCosmeticResources(
+CosmeticResources AdBlockService::UrlCosmeticResources(
     const std::string& url) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  absl::optional<base::Value> resources =
-      default_service()->UrlCosmeticResources(url);
+  const uint64_t generation = AdBlockDecisionCache::GetGeneration();
+  if (generation != cosmetic_resources_generation_) {
+    cosmetic_resources_cache_.Clear();
+    cosmetic_resources_generation_ = generation;
+  }
 
-  if (!resources || !resources->is_dict()) {
-    return resources;
+  auto cached = cosmetic_resources_cache_.Get(url);
+  if (cached != cosmetic_resources_cache_.end()) {
+    return cached->second;
   }
 
-  absl::optional<base::Value> regional_resources =
-      regional_service_manager()->UrlCosmeticResources(url);
+  CosmeticResources resources = MergeUrlCosmeticResources(url);
+  cosmetic_resources_cache_.Put(url, resources);
+  return resources;
+}
 
-  if (regional_resources && regional_resources->is_dict()) {
-    MergeResourcesInto(std::move(*regional_resources), &*resources,
-                       /*force_hide=*/true);
-  }
+CosmeticResources AdBlockService::MergeUrlCosmeticResources(
+    const std::string& url) {
+  CosmeticResources resources(default_service()->UrlCosmeticResources(url));
 
-  absl::optional<base::Value> custom_resources =
-      custom_filters_service()->UrlCosmeticResources(url);
+  absl::optional<CosmeticResources> regional_resources =
+      regional_service_manager()->UrlCosmeticResources(url);
 
-  if (custom_resources && custom_resources->is_dict()) {
-    MergeResourcesInto(std::move(*custom_resources), &*resources,
+  if (regional_resources) {
+    MergeResourcesInto(std::move(*regional_resources), &resources,
                        /*force_hide=*/true);
   }
 
-  absl::optional<base::Value> subscription_resources =
+  MergeResourcesInto(
+      CosmeticResources(custom_filters_service()->UrlCosmeticResources(url)),
+      &resources, /*force_hide=*/true);
+
+  absl::optional<CosmeticResources> subscription_resources =
       subscription_service_manager()->UrlCosmeticResources(url);
 
-  if (subscription_resources && subscription_resources->is_dict()) {
-    MergeResourcesInto(std::move(*subscription_resources), &*resources,
+  if (subscription_resources) {
+    MergeResourcesInto(std::move(*subscription_resources), &resources,
                        /*force_hide=*/true);
   }
 
@@ -290,7 +352,10 @@ AdBlockService::AdBlockService(
       task_runner_(task_runner),
       custom_filters_service_(nullptr, base::OnTaskRunnerDeleter(task_runner_)),
       default_service_(nullptr, base::OnTaskRunnerDeleter(task_runner_)),
-      subscription_service_manager_(std::move(subscription_service_manager)) {
+      subscription_service_manager_(std::move(subscription_service_manager)),
+      decision_cache_(kDecisionCacheSize),
+      cosmetic_resources_cache_(kCosmeticResourcesCacheSize),
+      cosmetic_resources_generation_(AdBlockDecisionCache::GetGeneration()) {
   // Initializes adblock-rust's domain resolution implementation
   adblock::SetDomainResolver(AdBlockServiceDomainResolver);
 
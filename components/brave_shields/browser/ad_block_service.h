@@ -12,13 +12,16 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
+#include "brave/components/brave_shields/browser/ad_block_decision_cache.h"
 #include "brave/components/brave_shields/browser/ad_block_filters_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_resource_provider.h"
+#include "brave/components/brave_shields/browser/ad_block_service_helper.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "content/public/browser/browser_thread.h"
@@ -42,6 +45,7 @@ namespace brave_shields {
 
 class AdBlockEngine;
 class AdBlockDefaultFiltersProvider;
+struct AdBlockRequestContext;
 class AdBlockRegionalServiceManager;
 class AdBlockCustomFiltersProvider;
 class AdBlockRegionalCatalogProvider;
@@ -102,7 +106,7 @@ class AdBlockService {
       const GURL& url,
       blink::mojom::ResourceType resource_type,
       const std::string& tab_host);
-  absl::optional<base::Value> UrlCosmeticResources(const std::string& url);
+  CosmeticResources UrlCosmeticResources(const std::string& url);
   base::Value HiddenClassIdSelectors(
       const std::vector<std::string>& classes,
       const std::vector<std::string>& ids,
@@ -132,6 +136,13 @@ class AdBlockService {
 
   AdBlockResourceProvider* resource_provider();
 
+  // Runs |request| through every engine, merging the result into |decision|
+  void ShouldStartRequest(const AdBlockRequestContext& request,
+                          bool aggressive_blocking,
+                          AdBlockDecisionCache::Decision* decision);
+  // Merges the cosmetic resources of every engine for |url|
+  CosmeticResources MergeUrlCosmeticResources(const std::string& url);
+
   void UseSourceProvidersForTest(AdBlockFiltersProvider* source_provider,
                                  AdBlockResourceProvider* resource_provider);
   void UseCustomSourceProvidersForTest(
@@ -163,6 +174,14 @@ class AdBlockService {
   std::unique_ptr<SourceProviderObserver> default_service_observer_;
   std::unique_ptr<SourceProviderObserver> custom_filters_service_observer_;
 
+  // Only accessed on |task_runner_|
+  AdBlockDecisionCache decision_cache_;
+  // Merged UrlCosmeticResources by url, dropped along with |decision_cache_|
+  // whenever AdBlockDecisionCache::GetGeneration changes. Only accessed on
+  // |task_runner_|.
+  base::LRUCache<std::string, CosmeticResources> cosmetic_resources_cache_;
+  uint64_t cosmetic_resources_generation_;
+
   SEQUENCE_CHECKER(sequence_checker_);
 
   base::WeakPtrFactory<AdBlockService> weak_factory_{this};
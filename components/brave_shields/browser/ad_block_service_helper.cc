@@ -6,6 +6,7 @@
 #include "brave/components/brave_shields/browser/ad_block_service_helper.h"
 
 #include <algorithm>
+#include <unordered_set>
 #include <utility>
 
 #include "base/json/json_reader.h"
@@ -18,6 +19,29 @@ using adblock::FilterList;
 
 namespace brave_shields {
 
+namespace {
+
+// Moves the strings in |from| to the end of |into|, skipping any that |into|
+// already holds. The same selector is often returned by several filter lists,
+// and sending it to the renderer more than once only grows the stylesheet.
+void AppendUniqueStrings(std::vector<std::string> from,
+                         std::vector<std::string>* into) {
+  std::unordered_set<std::string> seen(into->begin(), into->end());
+  for (auto& item : from) {
+    if (seen.insert(item).second)
+      into->push_back(std::move(item));
+  }
+}
+
+base::Value StringsToList(std::vector<std::string> strings) {
+  base::Value list(base::Value::Type::LIST);
+  for (auto& item : strings)
+    list.Append(std::move(item));
+  return list;
+}
+
+}  // namespace
+
 std::vector<FilterList>::const_iterator FindAdBlockFilterListByUUID(
     const std::vector<FilterList>& region_lists,
     const std::string& uuid) {
@@ -138,74 +162,66 @@ void MergeCspDirectiveInto(absl::optional<std::string> from,
   *into = absl::optional<std::string>(from_str + ", " + into_str);
 }
 
-// Merges the contents of the first UrlCosmeticResources Value into the second
-// one provided.
+CosmeticResources::CosmeticResources() = default;
+CosmeticResources::CosmeticResources(adblock::UrlCosmeticResources resources)
+    : resources(std::move(resources)) {}
+CosmeticResources::CosmeticResources(const CosmeticResources& other) = default;
+CosmeticResources::CosmeticResources(CosmeticResources&& other) = default;
+CosmeticResources& CosmeticResources::operator=(
+    const CosmeticResources& other) = default;
+CosmeticResources& CosmeticResources::operator=(CosmeticResources&& other) =
+    default;
+CosmeticResources::~CosmeticResources() = default;
+
+// Merges the contents of the first CosmeticResources into the second one
+// provided.
 //
 // If `force_hide` is true, the contents of `from`'s `hide_selectors` field
-// will be moved into a possibly new field of `into` called
-// `force_hide_selectors`.
-void MergeResourcesInto(base::Value from, base::Value* into, bool force_hide) {
-  base::Value* resources_hide_selectors = nullptr;
-  if (force_hide) {
-    resources_hide_selectors = into->FindKey("force_hide_selectors");
-    if (!resources_hide_selectors || !resources_hide_selectors->is_list()) {
-        into->SetKey("force_hide_selectors", base::ListValue());
-        resources_hide_selectors = into->FindKey("force_hide_selectors");
-    }
-  } else {
-    resources_hide_selectors = into->FindKey("hide_selectors");
-  }
-  base::Value* from_resources_hide_selectors =
-      from.FindKey("hide_selectors");
-  if (resources_hide_selectors && from_resources_hide_selectors) {
-    for (auto& selector : from_resources_hide_selectors->GetList()) {
-      resources_hide_selectors->Append(std::move(selector));
-    }
+// will be moved into `into`'s `force_hide_selectors`.
+void MergeResourcesInto(CosmeticResources from,
+                        CosmeticResources* into,
+                        bool force_hide) {
+  AppendUniqueStrings(std::move(from.resources.hide_selectors),
+                      force_hide ? &into->force_hide_selectors
+                                 : &into->resources.hide_selectors);
+  AppendUniqueStrings(std::move(from.force_hide_selectors),
+                      &into->force_hide_selectors);
+
+  for (auto& style_selector : from.resources.style_selectors) {
+    AppendUniqueStrings(
+        std::move(style_selector.second),
+        &into->resources.style_selectors[style_selector.first]);
   }
 
-  base::Value* resources_style_selectors = into->FindKey("style_selectors");
-  base::Value* from_resources_style_selectors =
-      from.FindKey("style_selectors");
-  if (resources_style_selectors && from_resources_style_selectors) {
-    for (auto i : from_resources_style_selectors->DictItems()) {
-      base::Value* resources_entry =
-          resources_style_selectors->FindKey(i.first);
-      if (resources_entry) {
-        for (auto& item : i.second.GetList()) {
-          resources_entry->Append(std::move(item));
-        }
-      } else {
-        resources_style_selectors->SetKey(i.first, std::move(i.second));
-      }
-    }
-  }
+  AppendUniqueStrings(std::move(from.resources.exceptions),
+                      &into->resources.exceptions);
 
-  base::Value* resources_exceptions = into->FindKey("exceptions");
-  base::Value* from_resources_exceptions = from.FindKey("exceptions");
-  if (resources_exceptions && from_resources_exceptions) {
-    for (auto& exception : from_resources_exceptions->GetList()) {
-      resources_exceptions->Append(std::move(exception));
-    }
-  }
+  into->resources.injected_script += '\n' + from.resources.injected_script;
 
-  base::Value* resources_injected_script = into->FindKey("injected_script");
-  base::Value* from_resources_injected_script =
-      from.FindKey("injected_script");
-  if (resources_injected_script && from_resources_injected_script) {
-    *resources_injected_script = base::Value(
-            resources_injected_script->GetString()
-            + '\n'
-            + from_resources_injected_script->GetString());
+  if (from.resources.generichide) {
+    into->resources.generichide = true;
   }
+}
 
-  base::Value* resources_generichide = into->FindKey("generichide");
-  base::Value* from_resources_generichide =
-      from.FindKey("generichide");
-  if (from_resources_generichide) {
-    if (from_resources_generichide->GetBool()) {
-      *resources_generichide = base::Value(true);
-    }
+base::Value CosmeticResourcesToValue(CosmeticResources resources) {
+  base::Value style_selectors(base::Value::Type::DICTIONARY);
+  for (auto& style_selector : resources.resources.style_selectors) {
+    style_selectors.SetKey(style_selector.first,
+                           StringsToList(std::move(style_selector.second)));
   }
+
+  base::Value value(base::Value::Type::DICTIONARY);
+  value.SetKey("hide_selectors",
+               StringsToList(std::move(resources.resources.hide_selectors)));
+  value.SetKey("force_hide_selectors",
+               StringsToList(std::move(resources.force_hide_selectors)));
+  value.SetKey("style_selectors", std::move(style_selectors));
+  value.SetKey("exceptions",
+               StringsToList(std::move(resources.resources.exceptions)));
+  value.SetStringKey("injected_script",
+                     std::move(resources.resources.injected_script));
+  value.SetBoolKey("generichide", resources.resources.generichide);
+  return value;
 }
 
 }  // namespace brave_shields
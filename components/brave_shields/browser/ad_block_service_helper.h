@@ -29,7 +29,28 @@ std::vector<adblock::FilterList> RegionalCatalogFromJSON(
 void MergeCspDirectiveInto(absl::optional<std::string> from,
                            absl::optional<std::string>* into);
 
-void MergeResourcesInto(base::Value from, base::Value* into, bool force_hide);
+// The UrlCosmeticResources of one or more engines. Hide selectors merged in
+// with |force_hide| are kept apart, as the renderer may skip
+// |resources.hide_selectors| but always applies |force_hide_selectors|.
+struct CosmeticResources {
+  CosmeticResources();
+  explicit CosmeticResources(adblock::UrlCosmeticResources resources);
+  CosmeticResources(const CosmeticResources& other);
+  CosmeticResources(CosmeticResources&& other);
+  CosmeticResources& operator=(const CosmeticResources& other);
+  CosmeticResources& operator=(CosmeticResources&& other);
+  ~CosmeticResources();
+
+  adblock::UrlCosmeticResources resources;
+  std::vector<std::string> force_hide_selectors;
+};
+
+void MergeResourcesInto(CosmeticResources from,
+                        CosmeticResources* into,
+                        bool force_hide);
+
+// Returns |resources| in the format read by the cosmetic filters renderer.
+base::Value CosmeticResourcesToValue(CosmeticResources resources);
 
 }  // namespace brave_shields
 
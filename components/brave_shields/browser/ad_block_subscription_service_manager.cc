@@ -21,6 +21,7 @@
 #include "base/time/time.h"
 #include "base/values.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "brave/components/brave_shields/browser/ad_block_decision_cache.h"
 #include "brave/components/brave_shields/browser/ad_block_engine.h"
 #include "brave/components/brave_shields/browser/ad_block_service_helper.h"
 #include "brave/components/brave_shields/browser/ad_block_subscription_filters_provider.h"
@@ -278,6 +279,7 @@ void AdBlockSubscriptionServiceManager::DeleteSubscription(
     DCHECK(it2 != subscription_filters_providers_.end());
     subscription_filters_providers_.erase(it2);
   }
+  AdBlockDecisionCache::Invalidate();
   ClearSubscriptionPrefs(sub_url);
 
   base::ThreadPool::PostTask(
@@ -408,6 +410,8 @@ void AdBlockSubscriptionServiceManager::UpdateSubscriptionPrefs(
   base::AutoLock lock(subscription_services_lock_);
   subscriptions_ = base::DictionaryValue::From(
       base::Value::ToUniquePtrValue(subscriptions_dict->Clone()));
+  // The enabled state of a subscription may have changed
+  AdBlockDecisionCache::Invalidate();
 }
 
 // Updates preferences to remove all state for the specified filter list
@@ -433,10 +437,7 @@ bool AdBlockSubscriptionServiceManager::Start() {
 }
 
 void AdBlockSubscriptionServiceManager::ShouldStartRequest(
-    const GURL& url,
-    blink::mojom::ResourceType resource_type,
-    const std::string& tab_host,
-    bool aggressive_blocking,
+    const AdBlockRequestContext& request,
     bool* did_match_rule,
     bool* did_match_exception,
     bool* did_match_important,
@@ -446,8 +447,8 @@ void AdBlockSubscriptionServiceManager::ShouldStartRequest(
     auto info = GetInfo(subscription_service.first);
     if (info && info->enabled) {
       subscription_service.second->ShouldStartRequest(
-          url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-          did_match_exception, did_match_important, mock_data_url);
+          request, did_match_rule, did_match_exception, did_match_important,
+          mock_data_url);
       if (did_match_important && *did_match_important) {
         return;
       }
@@ -471,22 +472,19 @@ void AdBlockSubscriptionServiceManager::AddResources(
   }
 }
 
-absl::optional<base::Value>
+absl::optional<CosmeticResources>
 AdBlockSubscriptionServiceManager::UrlCosmeticResources(
     const std::string& url) {
-  absl::optional<base::Value> first_value = absl::nullopt;
+  absl::optional<CosmeticResources> first_value = absl::nullopt;
 
   base::AutoLock lock(subscription_services_lock_);
   for (auto it = subscription_services_.begin();
        it != subscription_services_.end(); it++) {
     auto info = GetInfo(it->first);
     if (info && info->enabled) {
-      absl::optional<base::Value> next_value =
-          it->second->UrlCosmeticResources(url);
+      CosmeticResources next_value(it->second->UrlCosmeticResources(url));
       if (first_value) {
-        if (next_value) {
-          MergeResourcesInto(std::move(*next_value), &*first_value, false);
-        }
+        MergeResourcesInto(std::move(next_value), &*first_value, false);
       } else {
         first_value = std::move(next_value);
       }
@@ -22,6 +22,7 @@
 #include "brave/components/brave_component_updater/browser/brave_component.h"
 #include "brave/components/brave_shields/browser/ad_block_engine.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
+#include "brave/components/brave_shields/browser/ad_block_service_helper.h"
 #include "brave/components/brave_shields/browser/ad_block_subscription_download_manager.h"
 #include "components/component_updater/timer_update_scheduler.h"
 #include "components/prefs/pref_service.h"
@@ -89,10 +90,7 @@ class AdBlockSubscriptionServiceManager {
   void CreateSubscription(const GURL& sub_url);
 
   bool Start();
-  void ShouldStartRequest(const GURL& url,
-                          blink::mojom::ResourceType resource_type,
-                          const std::string& tab_host,
-                          bool aggressive_blocking,
+  void ShouldStartRequest(const AdBlockRequestContext& request,
                           bool* did_match_rule,
                           bool* did_match_exception,
                           bool* did_match_important,
@@ -100,7 +98,8 @@ class AdBlockSubscriptionServiceManager {
   void EnableTag(const std::string& tag, bool enabled);
   void AddResources(const std::string& resources);
 
-  absl::optional<base::Value> UrlCosmeticResources(const std::string& url);
+  absl::optional<CosmeticResources> UrlCosmeticResources(
+      const std::string& url);
   base::Value HiddenClassIdSelectors(
       const std::vector<std::string>& classes,
       const std::vector<std::string>& ids,
@@ -3,7 +3,12 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "base/json/json_reader.h"
+#include "base/values.h"
 #include "brave/components/brave_shields/browser/ad_block_service_helper.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -12,6 +17,48 @@ namespace brave_shields {
 
 using ::testing::_;
 
+namespace {
+
+std::vector<std::string> ListToStrings(const base::Value* list) {
+  std::vector<std::string> strings;
+  if (!list)
+    return strings;
+  for (const auto& item : list->GetList())
+    strings.push_back(item.GetString());
+  return strings;
+}
+
+absl::optional<CosmeticResources> CosmeticResourcesFromJSON(
+    const std::string& json) {
+  absl::optional<base::Value> value = base::JSONReader::Read(json);
+  if (!value || !value->is_dict())
+    return absl::nullopt;
+
+  CosmeticResources resources;
+  resources.resources.hide_selectors =
+      ListToStrings(value->FindListKey("hide_selectors"));
+  resources.force_hide_selectors =
+      ListToStrings(value->FindListKey("force_hide_selectors"));
+  if (const base::Value* style_selectors =
+          value->FindDictKey("style_selectors")) {
+    for (const auto item : style_selectors->DictItems()) {
+      resources.resources.style_selectors[item.first] =
+          ListToStrings(&item.second);
+    }
+  }
+  resources.resources.exceptions =
+      ListToStrings(value->FindListKey("exceptions"));
+  if (const std::string* injected_script =
+          value->FindStringKey("injected_script")) {
+    resources.resources.injected_script = *injected_script;
+  }
+  resources.resources.generichide =
+      value->FindBoolKey("generichide").value_or(false);
+  return resources;
+}
+
+}  // namespace
+
 class CosmeticResourceMergeTest : public testing::Test {
  public:
   CosmeticResourceMergeTest() {}
@@ -22,19 +69,20 @@ class CosmeticResourceMergeTest : public testing::Test {
           const std::string& b,
           bool force_hide,
           const std::string& expected) {
-    absl::optional<base::Value> a_val = base::JSONReader::Read(a);
+    absl::optional<CosmeticResources> a_val = CosmeticResourcesFromJSON(a);
     ASSERT_TRUE(a_val);
 
-    absl::optional<base::Value> b_val = base::JSONReader::Read(b);
+    absl::optional<CosmeticResources> b_val = CosmeticResourcesFromJSON(b);
     ASSERT_TRUE(b_val);
 
-    const absl::optional<base::Value> expected_val =
-        base::JSONReader::Read(expected);
+    absl::optional<CosmeticResources> expected_val =
+        CosmeticResourcesFromJSON(expected);
     ASSERT_TRUE(expected_val);
 
     MergeResourcesInto(std::move(b_val.value()), &*a_val, force_hide);
 
-    ASSERT_EQ(*a_val, *expected_val);
+    ASSERT_EQ(CosmeticResourcesToValue(std::move(*a_val)),
+              CosmeticResourcesToValue(std::move(*expected_val)));
   }
 
  protected:
@@ -306,5 +354,68 @@ TEST_F(CosmeticResourceMergeTest, MergeStyles) {
   CompareMergeFromStrings(a, b, false, expected);
 }
 
+TEST_F(CosmeticResourceMergeTest, MergeDuplicates) {
+  const std::string a = "{"
+      "\"hide_selectors\": [\"a\", \"b\"], "
+      "\"style_selectors\": {"
+          "\".c\": [\"color: #fff\"]"
+      "}, "
+      "\"exceptions\": [\"e\"], "
+      "\"injected_script\": \"\", "
+      "\"generichide\": false"
+  "}";
+  const std::string b = "{"
+      "\"hide_selectors\": [\"b\", \"d\", \"d\"], "
+      "\"style_selectors\": {"
+          "\".c\": [\"margin: 0\", \"color: #fff\"]"
+      "}, "
+      "\"exceptions\": [\"e\", \"f\"], "
+      "\"injected_script\": \"\", "
+      "\"generichide\": false"
+  "}";
+
+  const std::string expected = "{"
+      "\"hide_selectors\": [\"a\", \"b\", \"d\"], "
+      "\"style_selectors\": {"
+          "\".c\": [\"color: #fff\", \"margin: 0\"]"
+      "}, "
+      "\"exceptions\": [\"e\", \"f\"], "
+      "\"injected_script\": \"\n\", "
+      "\"generichide\": false"
+  "}";
+
+  CompareMergeFromStrings(a, b, false, expected);
+}
+
+TEST_F(CosmeticResourceMergeTest, MergeDuplicatesForceHide) {
+  const std::string a = "{"
+      "\"hide_selectors\": [\"a\"], "
+      "\"force_hide_selectors\": [\"b\"], "
+      "\"style_selectors\": {}, "
+      "\"exceptions\": [], "
+      "\"injected_script\": \"\", "
+      "\"generichide\": false"
+  "}";
+  const std::string b = "{"
+      "\"hide_selectors\": [\"a\", \"b\"], "
+      "\"style_selectors\": {}, "
+      "\"exceptions\": [], "
+      "\"injected_script\": \"\", "
+      "\"generichide\": false"
+  "}";
+
+  // Force hidden selectors are only deduplicated among themselves, since
+  // |hide_selectors| may be skipped by the renderer.
+  const std::string expected = "{"
+      "\"hide_selectors\": [\"a\"], "
+      "\"force_hide_selectors\": [\"b\", \"a\"], "
+      "\"style_selectors\": {}, "
+      "\"exceptions\": [], "
+      "\"injected_script\": \"\n\", "
+      "\"generichide\": false"
+  "}";
+
+  CompareMergeFromStrings(a, b, true, expected);
+}
 
 }  // namespace brave_shields
@@ -28,3 +28,25 @@ TEST(HTTPSEverywhereRecentlyUsedCacheTest, Operations) {
   cache.remove("kD");
   ASSERT_FALSE(cache.get("kD", &v));
 }
+
+TEST(HTTPSEverywhereRecentlyUsedCacheTest, Shards) {
+  using Cache = HTTPSERecentlyUsedCache<std::string>;
+  Cache cache(64, 4);
+
+  for (int i = 0; i < 16; i++) {
+    const std::string key = "k" + std::to_string(i);
+    cache.add(key, "v" + key);
+  }
+
+  for (int i = 0; i < 16; i++) {
+    const std::string key = "k" + std::to_string(i);
+    std::string v;
+    ASSERT_TRUE(cache.get(key, &v));
+    ASSERT_EQ("v" + key, v);
+  }
+
+  cache.remove("k3");
+  std::string v;
+  ASSERT_FALSE(cache.get("k3", &v));
+  ASSERT_TRUE(cache.get("k4", &v));
+}
@@ -0,0 +1,65 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULESET_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULESET_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace re2 {
+class RE2;
+}  // namespace re2
+
+namespace brave_shields {
+
+// The rules stored for one lookup domain in the HTTPS Everywhere database,
+// parsed from JSON and with every pattern compiled once.
+class HTTPSEverywhereRuleset {
+ public:
+  HTTPSEverywhereRuleset(const HTTPSEverywhereRuleset&) = delete;
+  HTTPSEverywhereRuleset& operator=(const HTTPSEverywhereRuleset&) = delete;
+  ~HTTPSEverywhereRuleset();
+
+  // Never returns nullptr; malformed JSON results in a ruleset which does not
+  // rewrite any URL.
+  static std::unique_ptr<HTTPSEverywhereRuleset> Parse(
+      const std::string& json);
+
+  // Returns the rewritten URL, or an empty string if no rule applies.
+  std::string Apply(const std::string& url) const;
+
+ private:
+  struct Rule {
+    Rule();
+    Rule(Rule&&);
+    Rule& operator=(Rule&&);
+    ~Rule();
+
+    // Set for rules which only replace "http" with "https"
+    bool upgrade = false;
+    std::unique_ptr<re2::RE2> from;
+    std::string to;
+  };
+
+  struct Target {
+    Target();
+    Target(Target&&);
+    Target& operator=(Target&&);
+    ~Target();
+
+    std::vector<std::unique_ptr<re2::RE2>> exclusions;
+    std::vector<Rule> rules;
+  };
+
+  HTTPSEverywhereRuleset();
+
+  std::vector<Target> targets_;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RULESET_H_
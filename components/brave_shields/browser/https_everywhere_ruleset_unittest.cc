@@ -0,0 +1,54 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/https_everywhere_ruleset.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+using brave_shields::HTTPSEverywhereRuleset;
+
+TEST(HTTPSEverywhereRulesetTest, Upgrade) {
+  auto ruleset = HTTPSEverywhereRuleset::Parse(R"([{"r": [{"d": 1}]}])");
+  EXPECT_EQ("https://example.com/",
+            ruleset->Apply("http://example.com/"));
+}
+
+TEST(HTTPSEverywhereRulesetTest, Rewrite) {
+  auto ruleset = HTTPSEverywhereRuleset::Parse(
+      R"([{"r": [{"f": "^http://(www\\.)?example\\.com/",
+                  "t": "https://www.example.com/"}]}])");
+  EXPECT_EQ("https://www.example.com/a",
+            ruleset->Apply("http://example.com/a"));
+  EXPECT_EQ("", ruleset->Apply("http://example.org/a"));
+}
+
+TEST(HTTPSEverywhereRulesetTest, RewriteWithCaptureGroup) {
+  auto ruleset = HTTPSEverywhereRuleset::Parse(
+      R"([{"r": [{"f": "^http://(\\w+)\\.example\\.com/",
+                  "t": "https://$1.example.net/"}]}])");
+  EXPECT_EQ("https://foo.example.net/",
+            ruleset->Apply("http://foo.example.com/"));
+}
+
+TEST(HTTPSEverywhereRulesetTest, Exclusion) {
+  auto ruleset = HTTPSEverywhereRuleset::Parse(
+      R"([{"e": [{"p": "^http://example\\.com/insecure.*"}],
+           "r": [{"d": 1}]}])");
+  EXPECT_EQ("", ruleset->Apply("http://example.com/insecure/page"));
+  EXPECT_EQ("https://example.com/secure",
+            ruleset->Apply("http://example.com/secure"));
+}
+
+TEST(HTTPSEverywhereRulesetTest, TargetWithoutRulesEndsLookup) {
+  auto ruleset =
+      HTTPSEverywhereRuleset::Parse(R"([{"e": []}, {"r": [{"d": 1}]}])");
+  EXPECT_EQ("", ruleset->Apply("http://example.com/"));
+}
+
+TEST(HTTPSEverywhereRulesetTest, MalformedJson) {
+  auto ruleset = HTTPSEverywhereRuleset::Parse("{");
+  ASSERT_TRUE(ruleset);
+  EXPECT_EQ("", ruleset->Apply("http://example.com/"));
+}
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
@@ -27,6 +28,8 @@ using brave_component_updater::BraveComponent;
 
 namespace brave_shields {
 
+class HTTPSEverywhereRuleset;
+
 extern const char kHTTPSEverywhereComponentName[];
 extern const char kHTTPSEverywhereComponentId[];
 extern const char kHTTPSEverywhereComponentBase64PublicKey[];
@@ -56,6 +59,7 @@ class HTTPSEverywhereService : public BaseBraveShieldsService {
     explicit Engine(HTTPSEverywhereService* service);
     Engine(const Engine&) = delete;
     Engine& operator=(const Engine&) = delete;
+    ~Engine();
 
     void Init(const base::FilePath& base_dir);
     bool GetHTTPSURL(const GURL* url,
@@ -63,12 +67,14 @@ class HTTPSEverywhereService : public BaseBraveShieldsService {
                      std::string* new_url);
 
    private:
-    std::string ApplyHTTPSRule(const std::string& originalUrl,
-                               const std::string& rule);
-    std::string CorrecttoRuleToRE2Engine(const std::string& to);
+    // Returns the compiled rules stored for |domain|, or nullptr if there are
+    // none. Lookups, including misses, are cached until the database changes.
+    const HTTPSEverywhereRuleset* GetRuleset(const std::string& domain);
     void CloseDatabase();
 
     leveldb::DB* level_db_;
+    base::LRUCache<std::string, std::unique_ptr<HTTPSEverywhereRuleset>>
+        rulesets_;
     HTTPSEverywhereService* service_;  // not owned
     SEQUENCE_CHECKER(sequence_checker_);
   };
@@ -21,6 +21,7 @@
 #include "brave/components/brave_private_cdn/private_cdn_request_helper.h"
 #include "brave/components/brave_today/browser/brave_news_p3a.h"
 #include "brave/components/brave_today/browser/direct_feed_controller.h"
+#include "brave/components/brave_today/browser/feed_cache.h"
 #include "brave/components/brave_today/browser/network.h"
 #include "brave/components/brave_today/common/brave_news.mojom-forward.h"
 #include "brave/components/brave_today/common/brave_news.mojom-shared.h"
@@ -61,7 +62,8 @@ BraveNewsController::BraveNewsController(
     PrefService* prefs,
     brave_ads::AdsService* ads_service,
     history::HistoryService* history_service,
-    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
+    const base::FilePath& profile_path)
     : prefs_(prefs),
       ads_service_(ads_service),
       api_request_helper_(GetNetworkTrafficAnnotationTag(), url_loader_factory),
@@ -72,7 +74,8 @@ BraveNewsController::BraveNewsController(
       feed_controller_(&publishers_controller_,
                        &direct_feed_controller_,
                        history_service,
-                       &api_request_helper_),
+                       &api_request_helper_,
+                       profile_path.Append(kFeedCacheFilename)),
       weak_ptr_factory_(this) {
   DCHECK(prefs);
   // Set up preference listeners
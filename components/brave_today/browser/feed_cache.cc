@@ -0,0 +1,93 @@
+// Copyright (c) 2022 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// you can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "brave/components/brave_today/browser/feed_cache.h"
+
+#include <utility>
+#include <vector>
+
+#include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/logging.h"
+#include "brave/components/brave_today/browser/feed_parsing.h"
+
+namespace brave_news {
+
+namespace {
+
+// Bump whenever the layout of the cache file changes. The feed itself is
+// stored as received, so it only changes along with the remote feed format.
+constexpr int kFeedCacheVersion = 1;
+
+constexpr char kVersionKey[] = "version";
+constexpr char kEtagKey[] = "etag";
+constexpr char kFeedKey[] = "feed";
+
+absl::optional<FeedCache> ParseFeedCache(const std::string& contents) {
+  absl::optional<base::Value> value = base::JSONReader::Read(contents);
+  if (!value || !value->is_dict()) {
+    return absl::nullopt;
+  }
+  if (value->FindIntKey(kVersionKey) != kFeedCacheVersion) {
+    VLOG(1) << "Brave News feed cache is of another version";
+    return absl::nullopt;
+  }
+  const std::string* etag = value->FindStringKey(kEtagKey);
+  const base::Value* records = value->FindListKey(kFeedKey);
+  if (!etag || !records) {
+    return absl::nullopt;
+  }
+
+  FeedCache cache;
+  cache.etag = *etag;
+  if (!ParseFeedItems(*records, &cache.items)) {
+    return absl::nullopt;
+  }
+  return cache;
+}
+
+}  // namespace
+
+FeedCache::FeedCache() = default;
+FeedCache::FeedCache(FeedCache&&) = default;
+FeedCache& FeedCache::operator=(FeedCache&&) = default;
+FeedCache::~FeedCache() = default;
+
+absl::optional<FeedCache> ReadFeedCache(const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents)) {
+    VLOG(1) << "No Brave News feed cache at " << path;
+    return absl::nullopt;
+  }
+
+  absl::optional<FeedCache> cache = ParseFeedCache(contents);
+  if (!cache) {
+    LOG(ERROR) << "Deleting unreadable Brave News feed cache at " << path;
+    base::DeleteFile(path);
+    return absl::nullopt;
+  }
+  return cache;
+}
+
+bool WriteFeedCache(const base::FilePath& path,
+                    const std::string& etag,
+                    base::Value records) {
+  base::Value cache(base::Value::Type::DICTIONARY);
+  cache.SetIntKey(kVersionKey, kFeedCacheVersion);
+  cache.SetStringKey(kEtagKey, etag);
+  cache.SetKey(kFeedKey, std::move(records));
+
+  std::string contents;
+  if (!base::JSONWriter::Write(cache, &contents) ||
+      !base::ImportantFileWriter::WriteFileAtomically(path, contents)) {
+    LOG(ERROR) << "Could not write Brave News feed cache to " << path;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace brave_news
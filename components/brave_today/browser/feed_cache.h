@@ -0,0 +1,49 @@
+// Copyright (c) 2022 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// you can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef BRAVE_COMPONENTS_BRAVE_TODAY_BROWSER_FEED_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_TODAY_BROWSER_FEED_CACHE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/values.h"
+#include "brave/components/brave_today/common/brave_news.mojom.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_news {
+
+constexpr base::FilePath::CharType kFeedCacheFilename[] =
+    FILE_PATH_LITERAL("Brave News Feed Cache");
+
+// Parsed items of the combined remote feed, as read back from the cache.
+struct FeedCache {
+  FeedCache();
+  FeedCache(FeedCache&&);
+  FeedCache& operator=(FeedCache&&);
+  ~FeedCache();
+
+  std::string etag;
+  std::vector<mojom::FeedItemPtr> items;
+};
+
+// Stores the combined feed json with its etag, so that a cold start can build
+// the feed without downloading it again. The items are read back with the
+// same parsing code as a downloaded feed. Both functions block and must run on
+// a sequence which allows it.
+
+// Returns nullopt if there is no cache at |path|. A cache which can't be read,
+// e.g. one written by another version, is deleted.
+absl::optional<FeedCache> ReadFeedCache(const base::FilePath& path);
+
+// |records| is the parsed json list of feed items.
+bool WriteFeedCache(const base::FilePath& path,
+                    const std::string& etag,
+                    base::Value records);
+
+}  // namespace brave_news
+
+#endif  // BRAVE_COMPONENTS_BRAVE_TODAY_BROWSER_FEED_CACHE_H_
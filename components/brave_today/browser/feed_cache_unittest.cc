@@ -0,0 +1,124 @@
+// Copyright (c) 2022 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// you can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "brave/components/brave_today/browser/feed_cache.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/values.h"
+#include "brave/components/brave_today/browser/feed_parsing.h"
+#include "brave/components/brave_today/common/brave_news.mojom.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_news {
+
+namespace {
+
+std::string GetFeedJson() {
+  return R"([
+        {
+          "category": "Technology",
+          "publish_time": "2021-09-01 07:01:28",
+          "url": "https://www.example.com/an-article/",
+          "title": "An article",
+          "description": "The description of an article",
+          "content_type": "article",
+          "publisher_id": "222",
+          "publisher_name": "Digital Trends",
+          "creative_instance_id": "",
+          "url_hash": "523b9f2091474c2a082c06ec17965f8c2392f871917407228bbeb51d8a55d6be",
+          "padded_img": "https://pcdn.brave.com/brave-today/cache/052e832456e00a3cee51c68eee206fe71c32cba35d5e53dee2777dd132e01364.jpg.pad",
+          "score": 13.93160989810695
+        },
+        {
+          "category": "Products",
+          "publish_time": "2021-09-01 07:04:32",
+          "url": "https://www.example.com/a-deal/",
+          "title": "A deal",
+          "description": "The description of a deal",
+          "content_type": "product",
+          "offers_category": "Laptops",
+          "publisher_id": "111",
+          "publisher_name": "Deals",
+          "creative_instance_id": "",
+          "url_hash": "7bb5d8b3e2eee9d317f0568dcb094850fdf2862b2ed6d583c62b2245ea507ab8",
+          "padded_img": "https://pcdn.brave.com/brave-today/cache/85fb134433369025b46b861a00408e61223678f55620612d980533fa6ce0a815.jpg.pad",
+          "score": 14.525910905005045
+        }
+      ])";
+}
+
+}  // namespace
+
+class BraveNewsFeedCacheTest : public testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    cache_path_ = temp_dir_.GetPath().Append(kFeedCacheFilename);
+  }
+
+ protected:
+  base::ScopedTempDir temp_dir_;
+  base::FilePath cache_path_;
+};
+
+TEST_F(BraveNewsFeedCacheTest, RoundTrip) {
+  absl::optional<base::Value> records = base::JSONReader::Read(GetFeedJson());
+  ASSERT_TRUE(records);
+  std::vector<mojom::FeedItemPtr> feed_items;
+  ASSERT_TRUE(ParseFeedItems(*records, &feed_items));
+  ASSERT_EQ(feed_items.size(), 2u);
+  ASSERT_TRUE(WriteFeedCache(cache_path_, "\"abc\"", std::move(*records)));
+
+  absl::optional<FeedCache> read_cache = ReadFeedCache(cache_path_);
+  ASSERT_TRUE(read_cache);
+  EXPECT_EQ(read_cache->etag, "\"abc\"");
+  ASSERT_EQ(read_cache->items.size(), 2u);
+  EXPECT_TRUE(read_cache->items[0]->is_article());
+  ASSERT_TRUE(read_cache->items[1]->is_deal());
+  EXPECT_EQ(read_cache->items[1]->get_deal()->offers_category, "Laptops");
+  EXPECT_TRUE(read_cache->items[0]->Equals(*feed_items[0]));
+  EXPECT_TRUE(read_cache->items[1]->Equals(*feed_items[1]));
+}
+
+TEST_F(BraveNewsFeedCacheTest, MissingCache) {
+  EXPECT_FALSE(ReadFeedCache(cache_path_));
+}
+
+TEST_F(BraveNewsFeedCacheTest, InvalidCacheIsDeleted) {
+  ASSERT_TRUE(base::WriteFile(cache_path_, "not json"));
+  EXPECT_FALSE(ReadFeedCache(cache_path_));
+  EXPECT_FALSE(base::PathExists(cache_path_));
+
+  ASSERT_TRUE(base::WriteFile(cache_path_, R"({"version": 1, "etag": "a"})"));
+  EXPECT_FALSE(ReadFeedCache(cache_path_));
+  EXPECT_FALSE(base::PathExists(cache_path_));
+}
+
+TEST_F(BraveNewsFeedCacheTest, OtherVersionIsDeleted) {
+  absl::optional<base::Value> records = base::JSONReader::Read(GetFeedJson());
+  ASSERT_TRUE(records);
+  ASSERT_TRUE(WriteFeedCache(cache_path_, "\"abc\"", std::move(*records)));
+
+  std::string contents;
+  ASSERT_TRUE(base::ReadFileToString(cache_path_, &contents));
+  absl::optional<base::Value> cache = base::JSONReader::Read(contents);
+  ASSERT_TRUE(cache && cache->is_dict());
+  cache->SetIntKey("version", 0);
+  ASSERT_TRUE(base::JSONWriter::Write(*cache, &contents));
+  ASSERT_TRUE(base::WriteFile(cache_path_, contents));
+
+  EXPECT_FALSE(ReadFeedCache(cache_path_));
+  EXPECT_FALSE(base::PathExists(cache_path_));
+}
+
+}  // namespace brave_news
@@ -14,11 +14,19 @@
 #include "base/barrier_callback.h"
 #include "base/bind.h"
 #include "base/callback_forward.h"
+#include "base/files/file_util.h"
+#include "base/json/json_reader.h"
+#include "base/logging.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/one_shot_event.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/task/task_traits.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_private_cdn/headers.h"
 #include "brave/components/brave_today/browser/direct_feed_controller.h"
 #include "brave/components/brave_today/browser/feed_building.h"
+#include "brave/components/brave_today/browser/feed_cache.h"
 #include "brave/components/brave_today/browser/feed_parsing.h"
 #include "brave/components/brave_today/browser/publishers_controller.h"
 #include "brave/components/brave_today/browser/urls.h"
@@ -26,12 +34,15 @@
 #include "brave/components/brave_today/common/brave_news.mojom.h"
 #include "components/history/core/browser/history_service.h"
 #include "components/history/core/browser/history_types.h"
+#include "mojo/public/cpp/bindings/clone_traits.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_news {
 
 namespace {
 
 const char kEtagHeaderKey[] = "etag";
+const char kIfNoneMatchHeaderKey[] = "If-None-Match";
 
 GURL GetFeedUrl() {
   GURL feed_url("https://" + brave_today::GetHostname() + "/brave-today/feed." +
@@ -39,19 +50,53 @@ GURL GetFeedUrl() {
   return feed_url;
 }
 
+FeedItems ParseAndCacheFeedItems(const base::FilePath& feed_cache_path,
+                                 const std::string& etag,
+                                 const std::string& json) {
+  FeedItems feed_items;
+  absl::optional<base::Value> records =
+      base::JSONReader::Read(json, base::JSONParserOptions::JSON_PARSE_RFC);
+  if (!records) {
+    LOG(ERROR) << "Invalid response, could not parse JSON, JSON is: " << json;
+    return feed_items;
+  }
+  if (!ParseFeedItems(*records, &feed_items) || feed_items.empty() ||
+      etag.empty()) {
+    return feed_items;
+  }
+  WriteFeedCache(feed_cache_path, etag, std::move(*records));
+  return feed_items;
+}
+
+mojom::FeedPtr BuildFeedFromItems(FeedItems feed_items,
+                                  std::unordered_set<std::string> history_hosts,
+                                  Publishers publishers) {
+  auto feed = mojom::Feed::New();
+  if (!BuildFeed(feed_items, history_hosts, &publishers, feed.get())) {
+    VLOG(1) << "ParseFeed reported failure.";
+  }
+  return feed;
+}
+
 }  // namespace
 
 FeedController::FeedController(
     PublishersController* publishers_controller,
     DirectFeedController* direct_feed_controller,
     history::HistoryService* history_service,
-    api_request_helper::APIRequestHelper* api_request_helper)
+    api_request_helper::APIRequestHelper* api_request_helper,
+    const base::FilePath& feed_cache_path)
     : publishers_controller_(publishers_controller),
       direct_feed_controller_(direct_feed_controller),
       history_service_(history_service),
       api_request_helper_(api_request_helper),
       on_current_update_complete_(new base::OneShotEvent()),
-      publishers_observation_(this) {
+      publishers_observation_(this),
+      task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})),
+      feed_cache_path_(feed_cache_path),
+      creation_time_(base::TimeTicks::Now()) {
   publishers_observation_.Observe(publishers_controller);
 }
 
@@ -148,16 +193,9 @@ void FeedController::EnsureFeedIsUpdating() {
                       history_hosts.insert(host);
                     }
                     VLOG(1) << "history hosts # " << history_hosts.size();
-                    // Parse directly to in-memory property
-                    controller->ResetFeed();
-                    std::vector<mojom::FeedItemPtr> feed_items;
-                    if (BuildFeed(all_feed_items, history_hosts, &publishers,
-                                  &controller->current_feed_)) {
-                    } else {
-                      VLOG(1) << "ParseFeed reported failure.";
-                    }
-                    // Let any callbacks know that the data is ready or errored.
-                    controller->NotifyUpdateDone();
+                    controller->BuildFeedInBackground(
+                        std::move(all_feed_items), std::move(history_hosts),
+                        std::move(publishers));
                   },
                   base::Unretained(controller), std::move(all_feed_items),
                   std::move(publishers));
@@ -232,7 +270,22 @@ void FeedController::UpdateIfRemoteChanged() {
 }
 
 void FeedController::ClearCache() {
+  // Drop the replies of fetches still in flight, which would otherwise write
+  // the feed back to disk after it's deleted.
+  weak_ptr_factory_.InvalidateWeakPtrs();
+  task_tracker_.TryCancelAll();
   ResetFeed();
+  combined_feed_items_.clear();
+  current_feed_etag_.clear();
+  has_read_feed_cache_ = false;
+  is_update_from_feed_cache_ = false;
+  // The dropped update will never finish by itself, so let its waiters know.
+  if (is_update_in_progress_) {
+    NotifyUpdateDone();
+  }
+  task_runner_->PostTask(
+      FROM_HERE,
+      base::BindOnce(base::GetDeleteFileCallback(), feed_cache_path_));
 }
 
 void FeedController::OnPublishersUpdated(PublishersController* controller) {
@@ -241,37 +294,110 @@ void FeedController::OnPublishersUpdated(PublishersController* controller) {
 }
 
 void FeedController::FetchCombinedFeed(GetFeedItemsCallback callback) {
-  // Handle the response
-  auto response_handler = base::BindOnce(
-      [](FeedController* controller, GetFeedItemsCallback callback, int status,
-         const std::string& body,
-         const base::flat_map<std::string, std::string>& headers) {
-        std::string etag;
-        if (headers.contains(kEtagHeaderKey)) {
-          etag = headers.at(kEtagHeaderKey);
-        }
-        VLOG(1) << "Downloaded feed, status: " << status << " etag: " << etag;
-        // Handle bad response
-        if (status != 200 || body.empty()) {
-          LOG(ERROR) << "Bad response from brave news feed.json. Status: "
-                     << status;
-          std::move(callback).Run({});
-          return;
-        }
-        // Only mark cache time of remote request if
-        // parsing was successful
-        controller->current_feed_etag_ = etag;
-        FeedItems feed_items;
-        ParseFeedItems(body, &feed_items);
-        std::move(callback).Run(std::move(feed_items));
-      },
-      base::Unretained(this), std::move(callback));
+  // The first fetch of a session can be answered from the disk cache
+  if (!has_read_feed_cache_) {
+    has_read_feed_cache_ = true;
+    task_runner_->PostTaskAndReplyWithResult(
+        FROM_HERE, base::BindOnce(&ReadFeedCache, feed_cache_path_),
+        base::BindOnce(&FeedController::OnFeedCacheRead,
+                       weak_ptr_factory_.GetWeakPtr(), std::move(callback)));
+    return;
+  }
+  // Only ask for the body if it differs from the items we already have
+  auto headers = brave::private_cdn_headers;
+  if (!combined_feed_items_.empty() && !current_feed_etag_.empty()) {
+    headers[kIfNoneMatchHeaderKey] = current_feed_etag_;
+  }
   // Send the request
   GURL feed_url(GetFeedUrl());
   VLOG(1) << "Making feed request to " << feed_url.spec();
-  api_request_helper_->Request("GET", feed_url, "", "", true,
-                               std::move(response_handler),
-                               brave::private_cdn_headers);
+  api_request_helper_->Request(
+      "GET", feed_url, "", "", true,
+      base::BindOnce(&FeedController::OnCombinedFeedResponse,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback)),
+      headers);
+}
+
+void FeedController::OnFeedCacheRead(GetFeedItemsCallback callback,
+                                     absl::optional<FeedCache> feed_cache) {
+  if (!feed_cache || feed_cache->items.empty()) {
+    FetchCombinedFeed(std::move(callback));
+    return;
+  }
+  VLOG(1) << "Using cached feed with etag: " << feed_cache->etag;
+  current_feed_etag_ = feed_cache->etag;
+  combined_feed_items_ = std::move(feed_cache->items);
+  is_update_from_feed_cache_ = true;
+  std::move(callback).Run(mojo::Clone(combined_feed_items_));
+}
+
+void FeedController::OnCombinedFeedResponse(
+    GetFeedItemsCallback callback,
+    int status,
+    const std::string& body,
+    const base::flat_map<std::string, std::string>& headers) {
+  std::string etag;
+  if (headers.contains(kEtagHeaderKey)) {
+    etag = headers.at(kEtagHeaderKey);
+  }
+  VLOG(1) << "Downloaded feed, status: " << status << " etag: " << etag;
+  if (status == 304 && !combined_feed_items_.empty()) {
+    std::move(callback).Run(mojo::Clone(combined_feed_items_));
+    return;
+  }
+  // Handle bad response
+  if (status != 200 || body.empty()) {
+    LOG(ERROR) << "Bad response from brave news feed.json. Status: " << status;
+    std::move(callback).Run({});
+    return;
+  }
+  task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&ParseAndCacheFeedItems, feed_cache_path_, etag, body),
+      base::BindOnce(&FeedController::OnCombinedFeedParsed,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback),
+                     etag));
+}
+
+void FeedController::OnCombinedFeedParsed(GetFeedItemsCallback callback,
+                                          const std::string& etag,
+                                          FeedItems feed_items) {
+  current_feed_etag_ = etag;
+  combined_feed_items_ = mojo::Clone(feed_items);
+  std::move(callback).Run(std::move(feed_items));
+}
+
+void FeedController::BuildFeedInBackground(
+    FeedItems feed_items,
+    std::unordered_set<std::string> history_hosts,
+    Publishers publishers) {
+  task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&BuildFeedFromItems, std::move(feed_items),
+                     std::move(history_hosts), std::move(publishers)),
+      base::BindOnce(&FeedController::OnFeedBuilt,
+                     weak_ptr_factory_.GetWeakPtr()));
+}
+
+void FeedController::OnFeedBuilt(mojom::FeedPtr feed) {
+  ResetFeed();
+  current_feed_.hash = std::move(feed->hash);
+  current_feed_.pages = std::move(feed->pages);
+  current_feed_.featured_item = std::move(feed->featured_item);
+  if (!has_built_first_feed_ && !current_feed_.hash.empty()) {
+    has_built_first_feed_ = true;
+    const base::TimeDelta time_to_first_feed =
+        base::TimeTicks::Now() - creation_time_;
+    if (is_update_from_feed_cache_) {
+      UMA_HISTOGRAM_MEDIUM_TIMES("Brave.Today.TimeToFirstFeed.FromCache",
+                                 time_to_first_feed);
+    } else {
+      UMA_HISTOGRAM_MEDIUM_TIMES("Brave.Today.TimeToFirstFeed.FromNetwork",
+                                 time_to_first_feed);
+    }
+  }
+  // Let any callbacks know that the data is ready or errored.
+  NotifyUpdateDone();
 }
 
 void FeedController::GetOrFetchFeed(base::OnceClosure callback) {
@@ -303,6 +429,12 @@ void FeedController::NotifyUpdateDone() {
   // can be waited for.
   is_update_in_progress_ = false;
   on_current_update_complete_ = std::make_unique<base::OneShotEvent>();
+  // A feed built from the disk cache may be stale, check whether the remote
+  // feed has changed since.
+  if (is_update_from_feed_cache_) {
+    is_update_from_feed_cache_ = false;
+    UpdateIfRemoteChanged();
+  }
 }
 
 }  // namespace brave_news
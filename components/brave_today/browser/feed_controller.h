@@ -8,16 +8,27 @@
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/one_shot_event.h"
 #include "base/scoped_observation.h"
+#include "base/time/time.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_today/browser/direct_feed_controller.h"
+#include "brave/components/brave_today/browser/feed_cache.h"
 #include "brave/components/brave_today/browser/publishers_controller.h"
 #include "brave/components/brave_today/common/brave_news.mojom.h"
 #include "components/history/core/browser/history_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace base {
+class SequencedTaskRunner;
+}  // namespace base
 
 namespace history {
 class HistoryService;
@@ -34,7 +45,8 @@ class FeedController : public PublishersController::Observer {
   FeedController(PublishersController* publishers_controller,
                  DirectFeedController* direct_feed_controller,
                  history::HistoryService* history_service,
-                 api_request_helper::APIRequestHelper* api_request_helper);
+                 api_request_helper::APIRequestHelper* api_request_helper,
+                 const base::FilePath& feed_cache_path);
   ~FeedController() override;
   FeedController(const FeedController&) = delete;
   FeedController& operator=(const FeedController&) = delete;
@@ -53,6 +65,8 @@ class FeedController : public PublishersController::Observer {
   // parsing).
   void EnsureFeedIsCached();
   void UpdateIfRemoteChanged();
+  // Forgets the feed and deletes its disk cache. Fetches still in flight are
+  // dropped.
   void ClearCache();
 
   // PublishersController::Observer
@@ -65,6 +79,20 @@ class FeedController : public PublishersController::Observer {
 
  private:
   void FetchCombinedFeed(GetFeedItemsCallback callback);
+  void OnFeedCacheRead(GetFeedItemsCallback callback,
+                       absl::optional<FeedCache> feed_cache);
+  void OnCombinedFeedResponse(
+      GetFeedItemsCallback callback,
+      int status,
+      const std::string& body,
+      const base::flat_map<std::string, std::string>& headers);
+  void OnCombinedFeedParsed(GetFeedItemsCallback callback,
+                            const std::string& etag,
+                            FeedItems feed_items);
+  void BuildFeedInBackground(FeedItems feed_items,
+                             std::unordered_set<std::string> history_hosts,
+                             Publishers publishers);
+  void OnFeedBuilt(mojom::FeedPtr feed);
   void GetOrFetchFeed(base::OnceClosure callback);
   void ResetFeed();
   void NotifyUpdateDone();
@@ -86,6 +114,22 @@ class FeedController : public PublishersController::Observer {
   mojom::Feed current_feed_;
   std::string current_feed_etag_;
   bool is_update_in_progress_ = false;
+
+  // Parsing, building and persisting the feed are too slow for the UI thread
+  // and run here instead.
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  base::FilePath feed_cache_path_;
+  // The latest parsed items of the combined feed, matching
+  // |current_feed_etag_|. Reused when the remote feed hasn't changed.
+  FeedItems combined_feed_items_;
+  bool has_read_feed_cache_ = false;
+  // Set while building a feed from the disk cache, which is checked against
+  // the remote feed once built.
+  bool is_update_from_feed_cache_ = false;
+  const base::TimeTicks creation_time_;
+  bool has_built_first_feed_ = false;
+
+  base::WeakPtrFactory<FeedController> weak_ptr_factory_{this};
 };
 
 }  // namespace brave_news
@@ -14,9 +14,14 @@
 
 namespace brave_news {
 
+// Parses the combined feed json. Can be called from any sequence.
 bool ParseFeedItems(const std::string& json,
                     std::vector<mojom::FeedItemPtr>* feed_items);
 
+// As above, for the already parsed json list of feed items.
+bool ParseFeedItems(const base::Value& records,
+                    std::vector<mojom::FeedItemPtr>* feed_items);
+
 }  // namespace brave_news
 
 #endif  // BRAVE_COMPONENTS_BRAVE_TODAY_BROWSER_FEED_PARSING_H_
@@ -55,6 +55,7 @@ void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry) {
   registry->RegisterBooleanPref(kShowWalletIconOnToolbar, true);
   registry->RegisterBooleanPref(kShowWalletTestNetworks, false);
   registry->RegisterDictionaryPref(kBraveWalletTransactions);
+  registry->RegisterBooleanPref(kBraveWalletTransactionsDBMigrated, false);
   registry->RegisterTimePref(kBraveWalletLastUnlockTime, base::Time());
   registry->RegisterTimePref(kBraveWalletP3ALastReportTime, base::Time());
   registry->RegisterTimePref(kBraveWalletP3AFirstReportTime, base::Time());
@@ -19,6 +19,7 @@
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/tx_meta.h"
+#include "brave/components/brave_wallet/browser/tx_store.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
@@ -102,7 +103,8 @@ TEST_F(EthNonceTrackerUnitTest, GetNonce) {
       base::BindLambdaForTesting([&](bool success) { run_loop.Quit(); }));
   run_loop.Run();
 
-  EthTxStateManager tx_state_manager(GetPrefs(), &service);
+  TxStore tx_store(GetPrefs(), base::FilePath());
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_store, &service);
   EthNonceTracker nonce_tracker(&tx_state_manager, &service);
 
   SetTransactionCount(2);
@@ -147,7 +149,8 @@ TEST_F(EthNonceTrackerUnitTest, NonceLock) {
       brave_wallet::mojom::kLocalhostChainId, mojom::CoinType::ETH,
       base::BindLambdaForTesting([&](bool success) { run_loop.Quit(); }));
   run_loop.Run();
-  EthTxStateManager tx_state_manager(GetPrefs(), &service);
+  TxStore tx_store(GetPrefs(), base::FilePath());
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_store, &service);
   EthNonceTracker nonce_tracker(&tx_state_manager, &service);
 
   SetTransactionCount(4);
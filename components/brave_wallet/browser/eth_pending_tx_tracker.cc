@@ -15,6 +15,7 @@
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/tx_meta.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "brave/components/brave_wallet/common/hex_utils.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_wallet {
@@ -117,13 +118,12 @@ void EthPendingTxTracker::OnSendRawTransaction(
     const std::string& error_message) {}
 
 bool EthPendingTxTracker::IsNonceTaken(const EthTxMeta& meta) {
-  auto confirmed_transactions = tx_state_manager_->GetTransactionsByStatus(
-      mojom::TransactionStatus::Confirmed, absl::nullopt);
+  const absl::optional<uint256_t> nonce = meta.tx()->nonce();
+  auto confirmed_transactions = tx_state_manager_->GetTransactionsByNonce(
+      nonce ? Uint256ValueToHex(*nonce) : "",
+      mojom::TransactionStatus::Confirmed);
   for (const auto& confirmed_transaction : confirmed_transactions) {
-    auto* eth_confirmed_transaction =
-        static_cast<EthTxMeta*>(confirmed_transaction.get());
-    if (eth_confirmed_transaction->tx()->nonce() == meta.tx()->nonce() &&
-        eth_confirmed_transaction->id() != meta.id())
+    if (confirmed_transaction->id() != meta.id())
       return true;
   }
   return false;
@@ -110,8 +110,11 @@ bool EthTxManager::ValidateTxData1559(const mojom::TxData1559Ptr& tx_data,
 EthTxManager::EthTxManager(TxService* tx_service,
                            JsonRpcService* json_rpc_service,
                            KeyringService* keyring_service,
-                           PrefService* prefs)
-    : TxManager(std::make_unique<EthTxStateManager>(prefs, json_rpc_service),
+                           PrefService* prefs,
+                           TxStore* tx_store)
+    : TxManager(std::make_unique<EthTxStateManager>(prefs,
+                                                    tx_store,
+                                                    json_rpc_service),
                 std::make_unique<EthBlockTracker>(json_rpc_service),
                 tx_service,
                 json_rpc_service,
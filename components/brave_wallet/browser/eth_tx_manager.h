@@ -27,6 +27,7 @@ class EthTxManagerUnitTest;
 
 class EthTxMeta;
 class TxService;
+class TxStore;
 class JsonRpcService;
 class KeyringService;
 
@@ -35,7 +36,8 @@ class EthTxManager : public TxManager, public EthBlockTracker::Observer {
   EthTxManager(TxService* tx_service,
                JsonRpcService* json_rpc_service,
                KeyringService* keyring_service,
-               PrefService* prefs);
+               PrefService* prefs,
+               TxStore* tx_store);
   ~EthTxManager() override;
   EthTxManager(const EthTxManager&) = delete;
   EthTxManager operator=(const EthTxManager&) = delete;
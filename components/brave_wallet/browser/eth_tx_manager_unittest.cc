@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "base/callback_helpers.h"
+#include "base/files/file_path.h"
 #include "base/json/json_reader.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
@@ -26,7 +27,6 @@
 #include "brave/components/brave_wallet/browser/hd_keyring.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/keyring_service.h"
-#include "brave/components/brave_wallet/browser/pref_names.h"
 #include "brave/components/brave_wallet/browser/tx_service.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
@@ -243,7 +243,8 @@ class EthTxManagerUnitTest : public testing::Test {
     keyring_service_.reset(
         new KeyringService(json_rpc_service_.get(), &prefs_));
     tx_service_.reset(new TxService(json_rpc_service_.get(),
-                                    keyring_service_.get(), &prefs_));
+                                    keyring_service_.get(), &prefs_,
+                                    base::FilePath()));
 
     base::RunLoop run_loop;
     json_rpc_service_->SetNetwork(brave_wallet::mojom::kLocalhostChainId,
@@ -2075,13 +2076,13 @@ TEST_F(EthTxManagerUnitTest, Reset) {
   auto tx = EthTransaction::FromTxData(tx_data, false);
   meta.set_tx(std::make_unique<EthTransaction>(*tx));
   eth_tx_manager()->tx_state_manager_->AddOrUpdateTx(meta);
-  EXPECT_TRUE(GetPrefs()->HasPrefPath(kBraveWalletTransactions));
+  EXPECT_TRUE(eth_tx_manager()->tx_state_manager_->GetTx("001"));
 
   tx_service_->Reset();
 
   EXPECT_FALSE(eth_tx_manager()->known_no_pending_tx_);
   EXPECT_FALSE(eth_tx_manager()->block_tracker_->IsRunning());
-  EXPECT_FALSE(GetPrefs()->HasPrefPath(kBraveWalletTransactions));
+  EXPECT_FALSE(eth_tx_manager()->tx_state_manager_->GetTx("001"));
 }
 
 }  //  namespace brave_wallet
@@ -22,8 +22,9 @@
 namespace brave_wallet {
 
 EthTxStateManager::EthTxStateManager(PrefService* prefs,
+                                     TxStore* tx_store,
                                      JsonRpcService* json_rpc_service)
-    : TxStateManager(prefs, json_rpc_service) {}
+    : TxStateManager(prefs, tx_store, json_rpc_service) {}
 
 EthTxStateManager::~EthTxStateManager() = default;
 
@@ -26,13 +26,15 @@ class Value;
 namespace brave_wallet {
 
 class TxMeta;
+class TxStore;
 class EthTxMeta;
 class JsonRpcService;
 
 class EthTxStateManager : public TxStateManager {
  public:
-  explicit EthTxStateManager(PrefService* prefs,
-                             JsonRpcService* json_rpc_service);
+  EthTxStateManager(PrefService* prefs,
+                    TxStore* tx_store,
+                    JsonRpcService* json_rpc_service);
   ~EthTxStateManager() override;
   EthTxStateManager(const EthTxStateManager&) = delete;
   EthTxStateManager operator=(const EthTxStateManager&) = delete;
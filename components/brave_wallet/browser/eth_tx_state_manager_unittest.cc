@@ -18,6 +18,7 @@
 #include "brave/components/brave_wallet/browser/eip2930_transaction.h"
 #include "brave/components/brave_wallet/browser/eth_tx_meta.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
+#include "brave/components/brave_wallet/browser/tx_store.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
 #include "components/prefs/pref_service.h"
@@ -43,8 +44,9 @@ class EthTxStateManagerUnitTest : public testing::Test {
     brave_wallet::RegisterProfilePrefs(prefs_.registry());
     json_rpc_service_.reset(
         new JsonRpcService(shared_url_loader_factory_, GetPrefs()));
-    eth_tx_state_manager_.reset(
-        new EthTxStateManager(GetPrefs(), json_rpc_service_.get()));
+    tx_store_ = std::make_unique<TxStore>(GetPrefs(), base::FilePath());
+    eth_tx_state_manager_.reset(new EthTxStateManager(
+        GetPrefs(), tx_store_.get(), json_rpc_service_.get()));
   }
 
   void SetNetwork(const std::string& chain_id) {
@@ -64,6 +66,7 @@ class EthTxStateManagerUnitTest : public testing::Test {
   scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
   std::unique_ptr<JsonRpcService> json_rpc_service_;
+  std::unique_ptr<TxStore> tx_store_;
   std::unique_ptr<EthTxStateManager> eth_tx_state_manager_;
 };
 
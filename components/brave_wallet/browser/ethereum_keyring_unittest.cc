@@ -91,6 +91,36 @@ TEST(EthereumKeyringUnitTest, Accounts) {
   EXPECT_TRUE(keyring2.GetAddress(0).empty());
 }
 
+TEST(EthereumKeyringUnitTest, AccountIndex) {
+  std::vector<uint8_t> seed;
+  EXPECT_TRUE(base::HexStringToBytes(
+      "13ca6c28d26812f82db27908de0b0b7b18940cc4e9d96ebd7de190f706741489907ef65b"
+      "8f9e36c31dc46e81472b6a5e40a4487e725ace445b8203f243fb8958",
+      &seed));
+  EthereumKeyring keyring;
+  keyring.ConstructRootHDKey(seed, "m/44'/60'/0'/0");
+
+  const size_t accounts_number = 1000;
+  keyring.AddAccounts(accounts_number);
+  for (size_t i = 0; i < accounts_number; i += 111) {
+    const std::string address = keyring.GetDiscoveryAddress(i);
+    EXPECT_EQ(keyring.GetAddress(i), address);
+    EXPECT_EQ(keyring.GetAccountIndex(address), i);
+  }
+
+  const std::string last_address = keyring.GetAddress(accounts_number - 1);
+  keyring.RemoveAccount();
+  EXPECT_EQ(keyring.GetAddress(accounts_number - 1), "");
+  EXPECT_FALSE(keyring.GetAccountIndex(last_address));
+
+  // Accounts added after a lookup are found too
+  keyring.AddAccounts(1);
+  EXPECT_EQ(keyring.GetAddress(accounts_number - 1), last_address);
+  EXPECT_EQ(keyring.GetAccountIndex(last_address), accounts_number - 1);
+  EXPECT_FALSE(
+      keyring.GetAccountIndex("0xDEADBEEFdeadbeefdeadbeefdeadbeefDEADBEEF"));
+}
+
 TEST(EthereumKeyringUnitTest, SignTransaction) {
   // Specific signature check is in eth_transaction_unittest.cc
   EthereumKeyring keyring;
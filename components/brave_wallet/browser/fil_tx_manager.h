@@ -20,6 +20,7 @@ class PrefService;
 namespace brave_wallet {
 
 class TxService;
+class TxStore;
 class JsonRpcService;
 class KeyringService;
 class FilNonceTracker;
@@ -31,7 +32,8 @@ class FilTxManager : public TxManager, public FilBlockTracker::Observer {
   FilTxManager(TxService* tx_service,
                JsonRpcService* json_rpc_service,
                KeyringService* keyring_service,
-               PrefService* prefs);
+               PrefService* prefs,
+               TxStore* tx_store);
   ~FilTxManager() override;
   FilTxManager(const FilTxManager&) = delete;
   FilTxManager operator=(const FilTxManager&) = delete;
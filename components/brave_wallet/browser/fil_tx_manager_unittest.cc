@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "base/files/file_path.h"
 #include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
@@ -49,7 +50,8 @@ class FilTxManagerUnitTest : public testing::Test {
     keyring_service_.reset(
         new KeyringService(json_rpc_service_.get(), &prefs_));
     tx_service_.reset(new TxService(json_rpc_service_.get(),
-                                    keyring_service_.get(), &prefs_));
+                                    keyring_service_.get(), &prefs_,
+                                    base::FilePath()));
 
     base::RunLoop run_loop;
     json_rpc_service_->SetNetwork(brave_wallet::mojom::kLocalhostChainId,
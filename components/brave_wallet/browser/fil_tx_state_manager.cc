@@ -19,8 +19,9 @@
 namespace brave_wallet {
 
 FilTxStateManager::FilTxStateManager(PrefService* prefs,
+                                     TxStore* tx_store,
                                      JsonRpcService* json_rpc_service)
-    : TxStateManager(prefs, json_rpc_service) {}
+    : TxStateManager(prefs, tx_store, json_rpc_service) {}
 
 FilTxStateManager::~FilTxStateManager() = default;
 
@@ -22,12 +22,15 @@ class Value;
 namespace brave_wallet {
 
 class TxMeta;
+class TxStore;
 class FilTxMeta;
 class JsonRpcService;
 
 class FilTxStateManager : public TxStateManager {
  public:
-  FilTxStateManager(PrefService* prefs, JsonRpcService* json_rpc_service);
+  FilTxStateManager(PrefService* prefs,
+                    TxStore* tx_store,
+                    JsonRpcService* json_rpc_service);
   ~FilTxStateManager() override;
   FilTxStateManager(const FilTxStateManager&) = delete;
   FilTxStateManager operator=(const FilTxStateManager&) = delete;
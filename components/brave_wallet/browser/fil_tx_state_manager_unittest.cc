@@ -14,6 +14,7 @@
 #include "brave/components/brave_wallet/browser/fil_transaction.h"
 #include "brave/components/brave_wallet/browser/fil_tx_meta.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
+#include "brave/components/brave_wallet/browser/tx_store.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
 #include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
@@ -36,8 +37,9 @@ class FilTxStateManagerUnitTest : public testing::Test {
     brave_wallet::RegisterProfilePrefs(prefs_.registry());
     json_rpc_service_.reset(
         new JsonRpcService(shared_url_loader_factory_, GetPrefs()));
-    fil_tx_state_manager_.reset(
-        new FilTxStateManager(GetPrefs(), json_rpc_service_.get()));
+    tx_store_ = std::make_unique<TxStore>(GetPrefs(), base::FilePath());
+    fil_tx_state_manager_.reset(new FilTxStateManager(
+        GetPrefs(), tx_store_.get(), json_rpc_service_.get()));
   }
 
   void SetNetwork(const std::string& chain_id) {
@@ -51,6 +53,7 @@ class FilTxStateManagerUnitTest : public testing::Test {
   scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
   std::unique_ptr<JsonRpcService> json_rpc_service_;
+  std::unique_ptr<TxStore> tx_store_;
   std::unique_ptr<FilTxStateManager> fil_tx_state_manager_;
 };
 
@@ -7,6 +7,8 @@
 
 #include <utility>
 
+#include "base/check_op.h"
+
 namespace brave_wallet {
 
 HDKeyring::HDKeyring() = default;
@@ -42,12 +44,20 @@ std::vector<std::string> HDKeyring::GetAccounts() const {
 
 absl::optional<size_t> HDKeyring::GetAccountIndex(
     const std::string& address) const {
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address) {
-      return i;
-    }
+  for (; indexed_accounts_ < accounts_.size(); ++indexed_accounts_) {
+    account_indices_[GetCachedAddress(indexed_accounts_)] = indexed_accounts_;
+  }
+
+  auto it = account_indices_.find(address);
+  if (it == account_indices_.end())
+    return absl::nullopt;
+  // Entries for removed accounts are dropped lazily
+  if (it->second >= accounts_.size() ||
+      GetCachedAddress(it->second) != address) {
+    account_indices_.erase(it);
+    return absl::nullopt;
   }
-  return absl::nullopt;
+  return it->second;
 }
 
 size_t HDKeyring::GetAccountsNumber() const {
@@ -56,6 +66,12 @@ size_t HDKeyring::GetAccountsNumber() const {
 
 void HDKeyring::RemoveAccount() {
   accounts_.pop_back();
+  if (indexed_accounts_ > accounts_.size())
+    indexed_accounts_ = accounts_.size();
+  if (account_addresses_.size() > accounts_.size()) {
+    account_indices_.erase(account_addresses_.back().address);
+    account_addresses_.resize(accounts_.size());
+  }
 }
 
 bool HDKeyring::AddImportedAddress(const std::string& address,
@@ -64,10 +80,8 @@ bool HDKeyring::AddImportedAddress(const std::string& address,
   if (imported_accounts_[address])
     return false;
   // Check if it is duplicate in derived accounts
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return false;
-  }
+  if (GetAccountIndex(address))
+    return false;
 
   imported_accounts_[address] = std::move(hd_key);
   return true;
@@ -97,7 +111,20 @@ bool HDKeyring::RemoveImportedAccount(const std::string& address) {
 std::string HDKeyring::GetAddress(size_t index) const {
   if (accounts_.empty() || index >= accounts_.size())
     return std::string();
-  return GetAddressInternal(accounts_[index].get());
+  return GetCachedAddress(index);
+}
+
+const std::string& HDKeyring::GetCachedAddress(size_t index) const {
+  DCHECK_LT(index, accounts_.size());
+  if (account_addresses_.size() < accounts_.size())
+    account_addresses_.resize(accounts_.size());
+
+  CachedAddress& cached = account_addresses_[index];
+  if (cached.hd_key != accounts_[index].get()) {
+    cached.hd_key = accounts_[index].get();
+    cached.address = GetAddressInternal(accounts_[index].get());
+  }
+  return cached.address;
 }
 
 std::string HDKeyring::GetDiscoveryAddress(size_t index) const {
@@ -129,10 +156,9 @@ HDKeyBase* HDKeyring::GetHDKeyFromAddress(const std::string& address) {
   const auto imported_accounts_iter = imported_accounts_.find(address);
   if (imported_accounts_iter != imported_accounts_.end())
     return imported_accounts_iter->second.get();
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return accounts_[i].get();
-  }
+  absl::optional<size_t> index = GetAccountIndex(address);
+  if (index)
+    return accounts_[*index].get();
   return nullptr;
 }
 
@@ -10,10 +10,12 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/gtest_prod_util.h"
+#include "base/memory/raw_ptr.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
@@ -70,6 +72,22 @@ class HDKeyring {
   FRIEND_TEST_ALL_PREFIXES(EthereumKeyringUnitTest, ConstructRootHDKey);
   FRIEND_TEST_ALL_PREFIXES(EthereumKeyringUnitTest, SignMessage);
   FRIEND_TEST_ALL_PREFIXES(SolanaKeyringUnitTest, ConstructRootHDKey);
+
+  struct CachedAddress {
+    raw_ptr<const HDKeyBase> hd_key = nullptr;
+    std::string address;
+  };
+
+  // Derived accounts are only ever appended to |accounts_| or removed from
+  // its back, so their addresses are cached by index. An entry is recomputed
+  // if the key at its index changed.
+  const std::string& GetCachedAddress(size_t index) const;
+
+  mutable std::vector<CachedAddress> account_addresses_;
+  // Address to index in |accounts_|, covering the first |indexed_accounts_|
+  // accounts.
+  mutable std::unordered_map<std::string, size_t> account_indices_;
+  mutable size_t indexed_accounts_ = 0;
 };
 
 }  // namespace brave_wallet
@@ -84,6 +84,22 @@ bool UTCDecryptPrivateKey(const std::string& derived_key,
   return true;
 }
 
+// Creating a context builds precomputed tables, so every key shares one.
+// Only the secp256k1 functions that take a const context are used with it,
+// which makes it safe to use from any thread. Never destroyed.
+const secp256k1_context* GetSecp256k1Context() {
+  static const secp256k1_context* const context = [] {
+    secp256k1_context* new_context = secp256k1_context_create(
+        SECP256K1_CONTEXT_SIGN | SECP256K1_CONTEXT_VERIFY);
+    // Blinds signing against side channels
+    std::vector<uint8_t> seed(32);
+    crypto::RandBytes(seed.data(), seed.size());
+    CHECK(secp256k1_context_randomize(new_context, seed.data()));
+    return new_context;
+  }();
+  return context;
+}
+
 }  // namespace
 
 HDKey::HDKey()
@@ -95,8 +111,7 @@ HDKey::HDKey()
       private_key_(0),
       public_key_(33),
       chain_code_(32),
-      secp256k1_ctx_(secp256k1_context_create(SECP256K1_CONTEXT_SIGN |
-                                              SECP256K1_CONTEXT_VERIFY)) {}
+      secp256k1_ctx_(GetSecp256k1Context()) {}
 HDKey::HDKey(uint8_t depth, uint32_t parent_fingerprint, uint32_t index)
     : depth_(depth),
       fingerprint_(0),
@@ -106,11 +121,9 @@ HDKey::HDKey(uint8_t depth, uint32_t parent_fingerprint, uint32_t index)
       private_key_(0),
       public_key_(33),
       chain_code_(32),
-      secp256k1_ctx_(secp256k1_context_create(SECP256K1_CONTEXT_SIGN |
-                                              SECP256K1_CONTEXT_VERIFY)) {}
+      secp256k1_ctx_(GetSecp256k1Context()) {}
 
 HDKey::~HDKey() {
-  secp256k1_context_destroy(secp256k1_ctx_);
   SecureZeroData(private_key_.data(), private_key_.size());
 }
 
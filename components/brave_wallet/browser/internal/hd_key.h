@@ -109,7 +109,8 @@ class HDKey : public HDKeyBase {
   std::vector<uint8_t> public_key_;
   std::vector<uint8_t> chain_code_;
 
-  raw_ptr<secp256k1_context> secp256k1_ctx_ = nullptr;
+  // Shared by all keys, see GetSecp256k1Context()
+  raw_ptr<const secp256k1_context> secp256k1_ctx_ = nullptr;
 
   HDKey(const HDKey&) = delete;
   HDKey& operator=(const HDKey&) = delete;
@@ -0,0 +1,226 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/json_rpc_request_batcher.h"
+
+#include "base/bind.h"
+#include "base/containers/contains.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+
+namespace brave_wallet {
+
+namespace {
+
+// Keeps a single batch from growing past what public RPC endpoints accept
+constexpr size_t kMaxBatchSize = 20;
+
+}  // namespace
+
+JsonRpcRequestBatcher::BatchEntry::BatchEntry() = default;
+JsonRpcRequestBatcher::BatchEntry::BatchEntry(BatchEntry&&) = default;
+JsonRpcRequestBatcher::BatchEntry&
+JsonRpcRequestBatcher::BatchEntry::operator=(BatchEntry&&) = default;
+JsonRpcRequestBatcher::BatchEntry::~BatchEntry() = default;
+
+JsonRpcRequestBatcher::Batch::Batch() = default;
+JsonRpcRequestBatcher::Batch::~Batch() = default;
+
+JsonRpcRequestBatcher::JsonRpcRequestBatcher(
+    api_request_helper::APIRequestHelper* api_request_helper,
+    base::TimeDelta batch_window)
+    : api_request_helper_(api_request_helper), batch_window_(batch_window) {
+  DCHECK(api_request_helper_);
+}
+
+JsonRpcRequestBatcher::~JsonRpcRequestBatcher() = default;
+
+void JsonRpcRequestBatcher::Request(
+    const GURL& network_url,
+    const std::string& json_payload,
+    bool auto_retry_on_network_change,
+    const base::flat_map<std::string, std::string>& headers,
+    bool can_share_response,
+    ResultCallback callback,
+    ResponseConversionCallback conversion_callback) {
+  if (conversion_callback) {
+    Send(network_url, json_payload, auto_retry_on_network_change, headers,
+         std::move(callback), std::move(conversion_callback));
+    return;
+  }
+
+  if (can_share_response) {
+    SharedRequestKey key(network_url, json_payload);
+    auto it = shared_requests_.find(key);
+    if (it != shared_requests_.end()) {
+      it->second.push_back(std::move(callback));
+      return;
+    }
+
+    shared_requests_[key].push_back(std::move(callback));
+    callback = base::BindOnce(&JsonRpcRequestBatcher::OnSharedResponse,
+                              weak_ptr_factory_.GetWeakPtr(), key);
+  }
+
+  if (batch_window_.is_zero() ||
+      base::Contains(batching_unsupported_urls_, network_url)) {
+    Send(network_url, json_payload, auto_retry_on_network_change, headers,
+         std::move(callback), base::NullCallback());
+    return;
+  }
+
+  absl::optional<base::Value> request = base::JSONReader::Read(json_payload);
+  if (!request || !request->is_dict() || !request->FindStringKey("method")) {
+    Send(network_url, json_payload, auto_retry_on_network_change, headers,
+         std::move(callback), base::NullCallback());
+    return;
+  }
+
+  BatchEntry entry;
+  entry.json_payload = json_payload;
+  if (const base::Value* id = request->FindKey("id"))
+    entry.id = id->Clone();
+  entry.request = std::move(*request);
+  entry.auto_retry_on_network_change = auto_retry_on_network_change;
+  entry.headers = headers;
+  entry.callback = std::move(callback);
+  AddToBatch(network_url, std::move(entry));
+}
+
+void JsonRpcRequestBatcher::Send(
+    const GURL& network_url,
+    const std::string& json_payload,
+    bool auto_retry_on_network_change,
+    const base::flat_map<std::string, std::string>& headers,
+    ResultCallback callback,
+    ResponseConversionCallback conversion_callback) {
+  api_request_helper_->Request("POST", network_url, json_payload,
+                               "application/json", auto_retry_on_network_change,
+                               std::move(callback), headers, -1u,
+                               std::move(conversion_callback));
+}
+
+void JsonRpcRequestBatcher::OnSharedResponse(
+    const SharedRequestKey& key,
+    int status,
+    const std::string& body,
+    const base::flat_map<std::string, std::string>& headers) {
+  auto it = shared_requests_.find(key);
+  if (it == shared_requests_.end())
+    return;
+
+  // Erase first so callers issuing the same request again get a fresh one
+  std::vector<ResultCallback> callbacks = std::move(it->second);
+  shared_requests_.erase(it);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(status, body, headers);
+}
+
+void JsonRpcRequestBatcher::AddToBatch(const GURL& network_url,
+                                       BatchEntry entry) {
+  BatchKey key(network_url, entry.headers);
+  std::unique_ptr<Batch>& batch = batches_[key];
+  if (!batch) {
+    batch = std::make_unique<Batch>();
+    batch->timer.Start(FROM_HERE, batch_window_,
+                       base::BindOnce(&JsonRpcRequestBatcher::SendBatch,
+                                      base::Unretained(this), key));
+  }
+
+  batch->entries.push_back(std::move(entry));
+  if (batch->entries.size() >= kMaxBatchSize)
+    SendBatch(key);
+}
+
+void JsonRpcRequestBatcher::SendBatch(const BatchKey& key) {
+  auto it = batches_.find(key);
+  if (it == batches_.end())
+    return;
+
+  const GURL& network_url = key.first;
+  std::vector<BatchEntry> entries = std::move(it->second->entries);
+  batches_.erase(it);
+
+  if (entries.size() == 1) {
+    BatchEntry& entry = entries.front();
+    Send(network_url, entry.json_payload, entry.auto_retry_on_network_change,
+         entry.headers, std::move(entry.callback), base::NullCallback());
+    return;
+  }
+
+  // Requests are renumbered by their position in the batch
+  base::Value requests(base::Value::Type::LIST);
+  bool auto_retry_on_network_change = true;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    BatchEntry& entry = entries[i];
+    base::Value request = std::move(entry.request);
+    request.SetIntKey("id", static_cast<int>(i));
+    requests.Append(std::move(request));
+
+    auto_retry_on_network_change &= entry.auto_retry_on_network_change;
+  }
+
+  std::string json_payload;
+  base::JSONWriter::Write(requests, &json_payload);
+  Send(network_url, json_payload, auto_retry_on_network_change, key.second,
+       base::BindOnce(&JsonRpcRequestBatcher::OnBatchResponse,
+                      weak_ptr_factory_.GetWeakPtr(), network_url,
+                      std::move(entries)),
+       base::NullCallback());
+}
+
+void JsonRpcRequestBatcher::OnBatchResponse(
+    const GURL& network_url,
+    std::vector<BatchEntry> entries,
+    int status,
+    const std::string& body,
+    const base::flat_map<std::string, std::string>& headers) {
+  // Network errors and error statuses such as rate limiting go to each caller
+  // as they are. Sending the requests again would only add to the load.
+  if (status < 200 || status > 299) {
+    for (auto& entry : entries)
+      std::move(entry.callback).Run(status, body, headers);
+    return;
+  }
+
+  absl::optional<base::Value> responses = base::JSONReader::Read(body);
+  if (!responses || !responses->is_list()) {
+    batching_unsupported_urls_.insert(network_url);
+    for (auto& entry : entries) {
+      Send(network_url, entry.json_payload, entry.auto_retry_on_network_change,
+           entry.headers, std::move(entry.callback), base::NullCallback());
+    }
+    return;
+  }
+
+  for (auto& response : responses->GetList()) {
+    if (!response.is_dict())
+      continue;
+    absl::optional<int> index = response.FindIntKey("id");
+    if (!index || *index < 0 || static_cast<size_t>(*index) >= entries.size())
+      continue;
+    BatchEntry& entry = entries[*index];
+    if (!entry.callback)
+      continue;
+
+    if (entry.id.is_none())
+      response.RemoveKey("id");
+    else
+      response.SetKey("id", entry.id.Clone());
+    std::string json_response;
+    base::JSONWriter::Write(response, &json_response);
+    std::move(entry.callback).Run(status, json_response, headers);
+  }
+
+  // Servers may leave out responses, so those requests are sent again alone
+  for (auto& entry : entries) {
+    if (!entry.callback)
+      continue;
+    Send(network_url, entry.json_payload, entry.auto_retry_on_network_change,
+         entry.headers, std::move(entry.callback), base::NullCallback());
+  }
+}
+
+}  // namespace brave_wallet
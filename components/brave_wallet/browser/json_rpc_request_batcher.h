@@ -0,0 +1,121 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_REQUEST_BATCHER_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_REQUEST_BATCHER_H_
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "base/values.h"
+#include "brave/components/api_request_helper/api_request_helper.h"
+#include "url/gurl.h"
+
+namespace brave_wallet {
+
+// Sends JSON-RPC requests on behalf of JsonRpcService.
+//
+// Identical requests (same url and payload) which are already in flight share
+// a single network request. When |batch_window| is not zero, requests to the
+// same url with the same headers made within that window are also sent
+// together as a JSON-RPC 2.0 batch, and the responses are handed back to each
+// caller by id. Urls which answer a batch successfully but not with an array
+// are not batched again.
+class JsonRpcRequestBatcher {
+ public:
+  using ResultCallback = api_request_helper::APIRequestHelper::ResultCallback;
+  using ResponseConversionCallback =
+      api_request_helper::APIRequestHelper::ResponseConversionCallback;
+
+  JsonRpcRequestBatcher(
+      api_request_helper::APIRequestHelper* api_request_helper,
+      base::TimeDelta batch_window);
+  ~JsonRpcRequestBatcher();
+  JsonRpcRequestBatcher(const JsonRpcRequestBatcher&) = delete;
+  JsonRpcRequestBatcher& operator=(const JsonRpcRequestBatcher&) = delete;
+
+  // |can_share_response| must be false for requests with side effects, such
+  // as sending a transaction. Requests with a |conversion_callback| are always
+  // sent on their own, as the conversion works on the raw response.
+  void Request(const GURL& network_url,
+               const std::string& json_payload,
+               bool auto_retry_on_network_change,
+               const base::flat_map<std::string, std::string>& headers,
+               bool can_share_response,
+               ResultCallback callback,
+               ResponseConversionCallback conversion_callback);
+
+ private:
+  using SharedRequestKey = std::pair<GURL, std::string>;
+  using Headers = base::flat_map<std::string, std::string>;
+  // Requests are only batched with requests sharing their url and headers, as
+  // a batch is sent with the headers of its requests.
+  using BatchKey = std::pair<GURL, Headers>;
+
+  struct BatchEntry {
+    BatchEntry();
+    BatchEntry(BatchEntry&&);
+    BatchEntry& operator=(BatchEntry&&);
+    ~BatchEntry();
+
+    std::string json_payload;
+    base::Value request;
+    base::Value id;
+    bool auto_retry_on_network_change = false;
+    base::flat_map<std::string, std::string> headers;
+    ResultCallback callback;
+  };
+
+  struct Batch {
+    Batch();
+    ~Batch();
+
+    std::vector<BatchEntry> entries;
+    base::OneShotTimer timer;
+  };
+
+  void Send(const GURL& network_url,
+            const std::string& json_payload,
+            bool auto_retry_on_network_change,
+            const base::flat_map<std::string, std::string>& headers,
+            ResultCallback callback,
+            ResponseConversionCallback conversion_callback);
+  void OnSharedResponse(
+      const SharedRequestKey& key,
+      int status,
+      const std::string& body,
+      const base::flat_map<std::string, std::string>& headers);
+
+  void AddToBatch(const GURL& network_url, BatchEntry entry);
+  void SendBatch(const BatchKey& key);
+  void OnBatchResponse(
+      const GURL& network_url,
+      std::vector<BatchEntry> entries,
+      int status,
+      const std::string& body,
+      const base::flat_map<std::string, std::string>& headers);
+
+  raw_ptr<api_request_helper::APIRequestHelper> api_request_helper_;
+  const base::TimeDelta batch_window_;
+
+  std::map<SharedRequestKey, std::vector<ResultCallback>> shared_requests_;
+  std::map<BatchKey, std::unique_ptr<Batch>> batches_;
+  std::set<GURL> batching_unsupported_urls_;
+
+  base::WeakPtrFactory<JsonRpcRequestBatcher> weak_ptr_factory_{this};
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_REQUEST_BATCHER_H_
@@ -0,0 +1,273 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/json_rpc_request_batcher.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/callback_helpers.h"
+#include "base/json/json_reader.h"
+#include "base/run_loop.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_status_code.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/data_decoder/public/cpp/test_support/in_process_data_decoder.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kNetworkUrl[] = "https://rpc.example.com/";
+
+std::string GetRequest(const std::string& method) {
+  return "{\"id\":1,\"jsonrpc\":\"2.0\",\"method\":\"" + method +
+         "\",\"params\":[]}";
+}
+
+std::string GetResponse(int id, const std::string& result) {
+  return "{\"id\":" + std::to_string(id) +
+         ",\"jsonrpc\":\"2.0\",\"result\":\"" + result + "\"}";
+}
+
+}  // namespace
+
+class JsonRpcRequestBatcherUnitTest : public testing::Test {
+ public:
+  JsonRpcRequestBatcherUnitTest()
+      : shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)),
+        api_request_helper_(TRAFFIC_ANNOTATION_FOR_TESTS,
+                            shared_url_loader_factory_) {
+    url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+        [&](const network::ResourceRequest& request) {
+          request_bodies_.push_back(
+              std::string(request.request_body->elements()
+                              ->at(0)
+                              .As<network::DataElementBytes>()
+                              .AsStringPiece()));
+          request_headers_.push_back(request.headers);
+        }));
+  }
+
+  ~JsonRpcRequestBatcherUnitTest() override = default;
+
+ protected:
+  void Request(JsonRpcRequestBatcher* batcher,
+               const std::string& json_payload,
+               bool can_share_response,
+               std::string* response) {
+    batcher->Request(
+        GURL(kNetworkUrl), json_payload, true, {}, can_share_response,
+        base::BindLambdaForTesting(
+            [response](int status, const std::string& body,
+                       const base::flat_map<std::string, std::string>&) {
+              EXPECT_EQ(200, status);
+              *response = body;
+            }),
+        base::NullCallback());
+  }
+
+  std::string Normalize(const std::string& json) {
+    absl::optional<base::Value> value = base::JSONReader::Read(json);
+    EXPECT_TRUE(value);
+    return value ? value->DebugString() : std::string();
+  }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  data_decoder::test::InProcessDataDecoder in_process_data_decoder_;
+  network::TestURLLoaderFactory url_loader_factory_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
+  api_request_helper::APIRequestHelper api_request_helper_;
+  std::vector<std::string> request_bodies_;
+  std::vector<net::HttpRequestHeaders> request_headers_;
+};
+
+TEST_F(JsonRpcRequestBatcherUnitTest, SharesInFlightResponses) {
+  JsonRpcRequestBatcher batcher(&api_request_helper_, base::TimeDelta());
+
+  std::string first_response;
+  std::string second_response;
+  Request(&batcher, GetRequest("eth_blockNumber"), true, &first_response);
+  Request(&batcher, GetRequest("eth_blockNumber"), true, &second_response);
+  base::RunLoop().RunUntilIdle();
+  ASSERT_EQ(1u, request_bodies_.size());
+
+  url_loader_factory_.AddResponse(kNetworkUrl, GetResponse(1, "0x1"));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(Normalize(GetResponse(1, "0x1")), Normalize(first_response));
+  EXPECT_EQ(first_response, second_response);
+
+  // Once answered, the same request goes to the network again
+  std::string third_response;
+  Request(&batcher, GetRequest("eth_blockNumber"), true, &third_response);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(2u, request_bodies_.size());
+}
+
+TEST_F(JsonRpcRequestBatcherUnitTest, DoesNotShareUnshareableResponses) {
+  JsonRpcRequestBatcher batcher(&api_request_helper_, base::TimeDelta());
+
+  std::string first_response;
+  std::string second_response;
+  Request(&batcher, GetRequest("eth_sendRawTransaction"), false,
+          &first_response);
+  Request(&batcher, GetRequest("eth_sendRawTransaction"), false,
+          &second_response);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(2u, request_bodies_.size());
+}
+
+TEST_F(JsonRpcRequestBatcherUnitTest, BatchesRequestsWithinWindow) {
+  JsonRpcRequestBatcher batcher(&api_request_helper_, base::Milliseconds(10));
+
+  std::string block_number;
+  std::string chain_id;
+  Request(&batcher, GetRequest("eth_blockNumber"), true, &block_number);
+  Request(&batcher, GetRequest("eth_chainId"), true, &chain_id);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(request_bodies_.empty());
+
+  task_environment_.FastForwardBy(base::Milliseconds(10));
+  ASSERT_EQ(1u, request_bodies_.size());
+  absl::optional<base::Value> batch =
+      base::JSONReader::Read(request_bodies_[0]);
+  ASSERT_TRUE(batch && batch->is_list());
+  ASSERT_EQ(2u, batch->GetList().size());
+  EXPECT_EQ(0, *batch->GetList()[0].FindIntKey("id"));
+  EXPECT_EQ(1, *batch->GetList()[1].FindIntKey("id"));
+
+  // Responses may come back in any order
+  url_loader_factory_.AddResponse(
+      kNetworkUrl,
+      "[" + GetResponse(1, "0x539") + "," + GetResponse(0, "0x10") + "]");
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(Normalize(GetResponse(1, "0x10")), Normalize(block_number));
+  EXPECT_EQ(Normalize(GetResponse(1, "0x539")), Normalize(chain_id));
+}
+
+TEST_F(JsonRpcRequestBatcherUnitTest, BatchesOnlyRequestsWithSameHeaders) {
+  JsonRpcRequestBatcher batcher(&api_request_helper_, base::Milliseconds(10));
+
+  const std::vector<std::pair<std::string, std::string>> requests = {
+      {"eth_blockNumber", "latest"},
+      {"eth_chainId", "latest"},
+      {"eth_gasPrice", "pending"}};
+  for (const auto& request : requests) {
+    batcher.Request(
+        GURL(kNetworkUrl), GetRequest(request.first), true,
+        {{"X-Eth-Method", "eth_call"}, {"X-eth-get-block", request.second}},
+        true, base::DoNothing(), base::NullCallback());
+  }
+  task_environment_.FastForwardBy(base::Milliseconds(10));
+  ASSERT_EQ(2u, request_bodies_.size());
+
+  // Each request is sent with its own headers
+  for (size_t i = 0; i < request_bodies_.size(); ++i) {
+    std::string method;
+    std::string block;
+    EXPECT_TRUE(request_headers_[i].GetHeader("X-Eth-Method", &method));
+    EXPECT_EQ("eth_call", method);
+    EXPECT_TRUE(request_headers_[i].GetHeader("X-eth-get-block", &block));
+    absl::optional<base::Value> body =
+        base::JSONReader::Read(request_bodies_[i]);
+    ASSERT_TRUE(body);
+    if (block == "latest") {
+      ASSERT_TRUE(body->is_list());
+      EXPECT_EQ(2u, body->GetList().size());
+    } else {
+      EXPECT_EQ("pending", block);
+      EXPECT_EQ(Normalize(GetRequest("eth_gasPrice")),
+                Normalize(request_bodies_[i]));
+    }
+  }
+}
+
+TEST_F(JsonRpcRequestBatcherUnitTest, FallsBackWhenBatchingIsUnsupported) {
+  JsonRpcRequestBatcher batcher(&api_request_helper_, base::Milliseconds(10));
+
+  std::string block_number;
+  std::string chain_id;
+  Request(&batcher, GetRequest("eth_blockNumber"), true, &block_number);
+  Request(&batcher, GetRequest("eth_chainId"), true, &chain_id);
+  task_environment_.FastForwardBy(base::Milliseconds(10));
+  ASSERT_EQ(1u, request_bodies_.size());
+
+  url_loader_factory_.AddResponse(
+      kNetworkUrl,
+      "{\"jsonrpc\":\"2.0\",\"error\":{\"code\":-32600,\"message\":\"batch "
+      "requests are not supported\"}}");
+  base::RunLoop().RunUntilIdle();
+  url_loader_factory_.ClearResponses();
+  ASSERT_EQ(3u, request_bodies_.size());
+  EXPECT_EQ(Normalize(GetRequest("eth_blockNumber")),
+            Normalize(request_bodies_[1]));
+  EXPECT_EQ(Normalize(GetRequest("eth_chainId")),
+            Normalize(request_bodies_[2]));
+
+  // Later requests to the same url are no longer held back
+  std::string gas_price;
+  Request(&batcher, GetRequest("eth_gasPrice"), true, &gas_price);
+  base::RunLoop().RunUntilIdle();
+  EXPECT_EQ(4u, request_bodies_.size());
+}
+
+TEST_F(JsonRpcRequestBatcherUnitTest, DoesNotFallBackOnErrorStatus) {
+  JsonRpcRequestBatcher batcher(&api_request_helper_, base::Milliseconds(10));
+
+  std::vector<int> statuses;
+  std::vector<std::string> responses;
+  for (const char* method : {"eth_blockNumber", "eth_chainId"}) {
+    batcher.Request(
+        GURL(kNetworkUrl), GetRequest(method), true, {}, true,
+        base::BindLambdaForTesting(
+            [&](int status, const std::string& body,
+                const base::flat_map<std::string, std::string>&) {
+              statuses.push_back(status);
+              responses.push_back(body);
+            }),
+        base::NullCallback());
+  }
+  task_environment_.FastForwardBy(base::Milliseconds(10));
+  ASSERT_EQ(1u, request_bodies_.size());
+
+  const std::string rate_limited =
+      "{\"jsonrpc\":\"2.0\",\"error\":{\"code\":-32005,\"message\":"
+      "\"rate limited\"}}";
+  url_loader_factory_.AddResponse(kNetworkUrl, rate_limited,
+                                  net::HTTP_TOO_MANY_REQUESTS);
+  base::RunLoop().RunUntilIdle();
+  url_loader_factory_.ClearResponses();
+
+  // Each caller gets the error and nothing is sent again
+  EXPECT_EQ(1u, request_bodies_.size());
+  EXPECT_EQ(std::vector<int>(2, net::HTTP_TOO_MANY_REQUESTS), statuses);
+  ASSERT_EQ(2u, responses.size());
+  EXPECT_EQ(Normalize(rate_limited), Normalize(responses[0]));
+  EXPECT_EQ(Normalize(rate_limited), Normalize(responses[1]));
+
+  // The url is still batched
+  std::string block_number;
+  std::string chain_id;
+  Request(&batcher, GetRequest("eth_blockNumber"), true, &block_number);
+  Request(&batcher, GetRequest("eth_chainId"), true, &chain_id);
+  task_environment_.FastForwardBy(base::Milliseconds(10));
+  ASSERT_EQ(2u, request_bodies_.size());
+  absl::optional<base::Value> batch =
+      base::JSONReader::Read(request_bodies_[1]);
+  ASSERT_TRUE(batch);
+  EXPECT_TRUE(batch->is_list());
+}
+
+}  // namespace brave_wallet
@@ -0,0 +1,195 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/json_rpc_response_cache.h"
+
+#include <utility>
+
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/metrics/histogram_macros.h"
+#include "base/values.h"
+
+namespace brave_wallet {
+
+namespace {
+
+struct CacheableMethod {
+  const char* method;
+  // Index of the block tag in params, or -1 if the call has none and always
+  // reads the latest state.
+  int block_tag_index;
+};
+
+constexpr CacheableMethod kCacheableMethods[] = {
+    {"eth_call", 1},
+    {"eth_getBalance", 1},
+    {"eth_getCode", 1},
+    {"eth_getStorageAt", 2},
+    {"getBalance", -1},
+    {"getTokenAccountBalance", -1},
+    {"Filecoin.ChainHead", -1},
+    {"Filecoin.WalletBalance", -1},
+};
+
+// Returns absl::nullopt for block tags whose result must not be cached, such
+// as "pending".
+absl::optional<bool> IsPinnedBlock(const base::Value* block_tag) {
+  if (!block_tag)
+    return false;
+
+  if (block_tag->is_string()) {
+    const std::string& tag = block_tag->GetString();
+    if (tag == "latest" || tag == "safe" || tag == "finalized")
+      return false;
+    if (tag == "earliest" || (tag.size() > 2 && tag.rfind("0x", 0) == 0))
+      return true;
+    return absl::nullopt;
+  }
+
+  // EIP-1898 block parameter
+  if (block_tag->is_dict() && (block_tag->FindKey("blockHash") ||
+                               block_tag->FindKey("blockNumber"))) {
+    return true;
+  }
+
+  return absl::nullopt;
+}
+
+}  // namespace
+
+JsonRpcResponseCache::Response::Response() = default;
+JsonRpcResponseCache::Response::Response(const Response&) = default;
+JsonRpcResponseCache::Response::~Response() = default;
+
+JsonRpcResponseCache::Entry::Entry() = default;
+JsonRpcResponseCache::Entry::Entry(const Entry&) = default;
+JsonRpcResponseCache::Entry::~Entry() = default;
+
+JsonRpcResponseCache::JsonRpcResponseCache(size_t max_size)
+    : entries_(max_size) {}
+
+JsonRpcResponseCache::~JsonRpcResponseCache() = default;
+
+absl::optional<JsonRpcResponseCache::Key> JsonRpcResponseCache::GetKey(
+    const GURL& network_url,
+    const std::string& json_payload) const {
+  absl::optional<base::Value> request = base::JSONReader::Read(json_payload);
+  if (!request || !request->is_dict())
+    return absl::nullopt;
+
+  const std::string* method = request->FindStringKey("method");
+  if (!method)
+    return absl::nullopt;
+
+  const CacheableMethod* cacheable_method = nullptr;
+  for (const auto& entry : kCacheableMethods) {
+    if (*method == entry.method) {
+      cacheable_method = &entry;
+      break;
+    }
+  }
+  if (!cacheable_method)
+    return absl::nullopt;
+
+  base::Value params(base::Value::Type::LIST);
+  if (const base::Value* found_params = request->FindKey("params"))
+    params = found_params->Clone();
+
+  const base::Value* block_tag = nullptr;
+  if (cacheable_method->block_tag_index >= 0 && params.is_list() &&
+      params.GetList().size() >
+          static_cast<size_t>(cacheable_method->block_tag_index)) {
+    block_tag = &params.GetList()[cacheable_method->block_tag_index];
+  }
+  absl::optional<bool> is_pinned_block = IsPinnedBlock(block_tag);
+  if (!is_pinned_block)
+    return absl::nullopt;
+
+  std::string serialized_params;
+  if (!base::JSONWriter::Write(params, &serialized_params))
+    return absl::nullopt;
+
+  Key key;
+  key.cache_key =
+      network_url.spec() + "\n" + *method + "\n" + serialized_params;
+  key.network_url = network_url;
+  key.is_pinned_block = *is_pinned_block;
+  key.generation = GetGeneration(network_url);
+  return key;
+}
+
+const JsonRpcResponseCache::Response* JsonRpcResponseCache::Get(
+    const Key& key) {
+  auto it = entries_.Get(key.cache_key);
+  if (it != entries_.end() && it->second.expiry <= base::TimeTicks::Now()) {
+    entries_.Erase(it);
+    it = entries_.end();
+  }
+
+  const bool hit = it != entries_.end();
+  UMA_HISTOGRAM_BOOLEAN("Brave.Wallet.JsonRpcResponseCacheHit", hit);
+  if (!hit) {
+    stats_.misses++;
+    return nullptr;
+  }
+
+  stats_.hits++;
+  stats_.bytes_saved += it->second.response.body.size();
+  return &it->second.response;
+}
+
+void JsonRpcResponseCache::Put(
+    const Key& key,
+    const std::string& body,
+    const base::flat_map<std::string, std::string>& headers) {
+  if (!key.is_pinned_block &&
+      key.generation != GetGeneration(key.network_url)) {
+    return;
+  }
+
+  // Errors may be transient, e.g. rate limiting
+  absl::optional<base::Value> response = base::JSONReader::Read(body);
+  if (!response || !response->is_dict() || !response->FindKey("result") ||
+      response->FindKey("error")) {
+    return;
+  }
+
+  Entry entry;
+  entry.response.body = body;
+  entry.response.headers = headers;
+  entry.network_url = key.network_url;
+  entry.is_pinned_block = key.is_pinned_block;
+  entry.expiry = base::TimeTicks::Now() +
+                 (key.is_pinned_block ? kPinnedBlockTTL : kLatestBlockTTL);
+  entries_.Put(key.cache_key, std::move(entry));
+}
+
+void JsonRpcResponseCache::OnNewBlock(const GURL& network_url,
+                                      uint256_t block_number) {
+  auto latest_block = latest_blocks_.find(network_url);
+  if (latest_block != latest_blocks_.end() &&
+      latest_block->second >= block_number) {
+    return;
+  }
+  latest_blocks_[network_url] = block_number;
+
+  generations_[network_url]++;
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (!it->second.is_pinned_block &&
+        it->second.network_url == network_url) {
+      it = entries_.Erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+uint64_t JsonRpcResponseCache::GetGeneration(const GURL& network_url) const {
+  auto it = generations_.find(network_url);
+  return it == generations_.end() ? 0 : it->second;
+}
+
+}  // namespace brave_wallet
@@ -0,0 +1,106 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_RESPONSE_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_RESPONSE_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "base/containers/flat_map.h"
+#include "base/containers/lru_cache.h"
+#include "base/time/time.h"
+#include "brave/components/brave_wallet/common/brave_wallet_types.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "url/gurl.h"
+
+namespace brave_wallet {
+
+// Caches responses to read-only JSON-RPC calls such as eth_call and
+// eth_getBalance, keyed on the network, method and params.
+//
+// Calls made against a pinned block number are kept for a long time, as their
+// result can't change short of a reorg. Calls made against the latest block
+// are kept for a short time and dropped as soon as a new block is seen on
+// their network. Calls against the pending block are never cached.
+class JsonRpcResponseCache {
+ public:
+  struct Key {
+    std::string cache_key;
+    GURL network_url;
+    bool is_pinned_block = false;
+    uint64_t generation = 0;
+  };
+
+  struct Response {
+    Response();
+    Response(const Response&);
+    ~Response();
+
+    std::string body;
+    base::flat_map<std::string, std::string> headers;
+  };
+
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t bytes_saved = 0;
+  };
+
+  static constexpr base::TimeDelta kLatestBlockTTL = base::Seconds(5);
+  static constexpr base::TimeDelta kPinnedBlockTTL = base::Minutes(10);
+
+  explicit JsonRpcResponseCache(size_t max_size);
+  ~JsonRpcResponseCache();
+  JsonRpcResponseCache(const JsonRpcResponseCache&) = delete;
+  JsonRpcResponseCache& operator=(const JsonRpcResponseCache&) = delete;
+
+  // Returns absl::nullopt if responses to |json_payload| must not be cached.
+  absl::optional<Key> GetKey(const GURL& network_url,
+                             const std::string& json_payload) const;
+
+  // Returns nullptr and counts a miss if there's no fresh response for |key|.
+  const Response* Get(const Key& key);
+
+  // Only successful results are stored. Responses to requests sent before the
+  // latest invalidation of their network are dropped, since they may predate
+  // the new block.
+  void Put(const Key& key,
+           const std::string& body,
+           const base::flat_map<std::string, std::string>& headers);
+
+  // Drops responses for the latest block of |network_url| if |block_number|
+  // is newer than the last one seen.
+  void OnNewBlock(const GURL& network_url, uint256_t block_number);
+
+  const Stats& stats() const { return stats_; }
+
+ private:
+  struct Entry {
+    Entry();
+    Entry(const Entry&);
+    ~Entry();
+
+    Response response;
+    GURL network_url;
+    bool is_pinned_block = false;
+    base::TimeTicks expiry;
+  };
+
+  uint64_t GetGeneration(const GURL& network_url) const;
+
+  base::LRUCache<std::string, Entry> entries_;
+  base::flat_map<GURL, uint256_t> latest_blocks_;
+  // Bumped on each new block of a network, so that a block on one network
+  // doesn't drop in-flight responses for the others.
+  base::flat_map<GURL, uint64_t> generations_;
+  Stats stats_;
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_RESPONSE_CACHE_H_
@@ -0,0 +1,170 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/json_rpc_response_cache.h"
+
+#include <string>
+
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kNetworkUrl[] = "https://rpc.example.com/";
+constexpr char kOtherNetworkUrl[] = "https://other-rpc.example.com/";
+constexpr char kResult[] = "{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":\"0x1\"}";
+
+std::string GetBalanceRequest(const std::string& block_tag) {
+  return "{\"id\":1,\"jsonrpc\":\"2.0\",\"method\":\"eth_getBalance\","
+         "\"params\":[\"0x4e02ff\",\"" +
+         block_tag + "\"]}";
+}
+
+}  // namespace
+
+class JsonRpcResponseCacheUnitTest : public testing::Test {
+ public:
+  JsonRpcResponseCacheUnitTest() = default;
+  ~JsonRpcResponseCacheUnitTest() override = default;
+
+ protected:
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  JsonRpcResponseCache cache_{10};
+};
+
+TEST_F(JsonRpcResponseCacheUnitTest, GetKey) {
+  const GURL network_url(kNetworkUrl);
+
+  auto latest = cache_.GetKey(network_url, GetBalanceRequest("latest"));
+  ASSERT_TRUE(latest);
+  EXPECT_FALSE(latest->is_pinned_block);
+
+  auto pinned = cache_.GetKey(network_url, GetBalanceRequest("0x1b4"));
+  ASSERT_TRUE(pinned);
+  EXPECT_TRUE(pinned->is_pinned_block);
+  EXPECT_NE(latest->cache_key, pinned->cache_key);
+
+  // The request id is not part of the key
+  auto other_id = cache_.GetKey(
+      network_url,
+      "{\"id\":7,\"jsonrpc\":\"2.0\",\"method\":\"eth_getBalance\","
+      "\"params\":[\"0x4e02ff\",\"latest\"]}");
+  ASSERT_TRUE(other_id);
+  EXPECT_EQ(latest->cache_key, other_id->cache_key);
+
+  auto other_network =
+      cache_.GetKey(GURL(kOtherNetworkUrl), GetBalanceRequest("latest"));
+  ASSERT_TRUE(other_network);
+  EXPECT_NE(latest->cache_key, other_network->cache_key);
+
+  EXPECT_FALSE(cache_.GetKey(network_url, GetBalanceRequest("pending")));
+  EXPECT_FALSE(cache_.GetKey(
+      network_url,
+      "{\"id\":1,\"jsonrpc\":\"2.0\",\"method\":\"eth_sendRawTransaction\","
+      "\"params\":[\"0xf86c\"]}"));
+  EXPECT_FALSE(cache_.GetKey(network_url, "not json"));
+}
+
+TEST_F(JsonRpcResponseCacheUnitTest, GetAndPut) {
+  auto key = cache_.GetKey(GURL(kNetworkUrl), GetBalanceRequest("latest"));
+  ASSERT_TRUE(key);
+  EXPECT_FALSE(cache_.Get(*key));
+
+  cache_.Put(*key, kResult, {{"content-type", "application/json"}});
+  const JsonRpcResponseCache::Response* response = cache_.Get(*key);
+  ASSERT_TRUE(response);
+  EXPECT_EQ(kResult, response->body);
+  EXPECT_EQ("application/json", response->headers.at("content-type"));
+
+  EXPECT_EQ(1u, cache_.stats().hits);
+  EXPECT_EQ(1u, cache_.stats().misses);
+  EXPECT_EQ(std::string(kResult).size(), cache_.stats().bytes_saved);
+}
+
+TEST_F(JsonRpcResponseCacheUnitTest, DoesNotCacheErrors) {
+  auto key = cache_.GetKey(GURL(kNetworkUrl), GetBalanceRequest("latest"));
+  ASSERT_TRUE(key);
+
+  cache_.Put(*key,
+             "{\"id\":1,\"jsonrpc\":\"2.0\",\"error\":{\"code\":-32005,"
+             "\"message\":\"rate limited\"}}",
+             {});
+  EXPECT_FALSE(cache_.Get(*key));
+}
+
+TEST_F(JsonRpcResponseCacheUnitTest, Expiry) {
+  auto latest = cache_.GetKey(GURL(kNetworkUrl), GetBalanceRequest("latest"));
+  auto pinned = cache_.GetKey(GURL(kNetworkUrl), GetBalanceRequest("0x1b4"));
+  ASSERT_TRUE(latest);
+  ASSERT_TRUE(pinned);
+  cache_.Put(*latest, kResult, {});
+  cache_.Put(*pinned, kResult, {});
+
+  task_environment_.FastForwardBy(JsonRpcResponseCache::kLatestBlockTTL);
+  EXPECT_FALSE(cache_.Get(*latest));
+  EXPECT_TRUE(cache_.Get(*pinned));
+
+  task_environment_.FastForwardBy(JsonRpcResponseCache::kPinnedBlockTTL);
+  EXPECT_FALSE(cache_.Get(*pinned));
+}
+
+TEST_F(JsonRpcResponseCacheUnitTest, OnNewBlock) {
+  const GURL network_url(kNetworkUrl);
+  const GURL other_network_url(kOtherNetworkUrl);
+  cache_.OnNewBlock(network_url, 100);
+
+  auto latest = cache_.GetKey(network_url, GetBalanceRequest("latest"));
+  auto pinned = cache_.GetKey(network_url, GetBalanceRequest("0x1b4"));
+  auto other_latest =
+      cache_.GetKey(other_network_url, GetBalanceRequest("latest"));
+  ASSERT_TRUE(latest);
+  ASSERT_TRUE(pinned);
+  ASSERT_TRUE(other_latest);
+  cache_.Put(*latest, kResult, {});
+  cache_.Put(*pinned, kResult, {});
+  cache_.Put(*other_latest, kResult, {});
+
+  // The same block again changes nothing
+  cache_.OnNewBlock(network_url, 100);
+  EXPECT_TRUE(cache_.Get(*latest));
+
+  cache_.OnNewBlock(network_url, 101);
+  EXPECT_FALSE(cache_.Get(*latest));
+  EXPECT_TRUE(cache_.Get(*pinned));
+  EXPECT_TRUE(cache_.Get(*other_latest));
+
+  // A response to a request sent before the new block is not stored
+  cache_.Put(*latest, kResult, {});
+  EXPECT_FALSE(cache_.Get(*latest));
+
+  auto fresh_latest = cache_.GetKey(network_url, GetBalanceRequest("latest"));
+  ASSERT_TRUE(fresh_latest);
+  cache_.Put(*fresh_latest, kResult, {});
+  EXPECT_TRUE(cache_.Get(*fresh_latest));
+}
+
+TEST_F(JsonRpcResponseCacheUnitTest, OnNewBlockKeepsInFlightOtherNetworks) {
+  const GURL network_url(kNetworkUrl);
+  const GURL other_network_url(kOtherNetworkUrl);
+
+  auto latest = cache_.GetKey(network_url, GetBalanceRequest("latest"));
+  auto other_latest =
+      cache_.GetKey(other_network_url, GetBalanceRequest("latest"));
+  ASSERT_TRUE(latest);
+  ASSERT_TRUE(other_latest);
+
+  // Both requests are in flight when a block arrives on one network only
+  cache_.OnNewBlock(network_url, 100);
+
+  cache_.Put(*latest, kResult, {});
+  cache_.Put(*other_latest, kResult, {});
+  EXPECT_FALSE(cache_.Get(*latest));
+  EXPECT_TRUE(cache_.Get(*other_latest));
+}
+
+}  // namespace brave_wallet
@@ -11,9 +11,11 @@
 #include "base/base64.h"
 #include "base/bind.h"
 #include "base/environment.h"
+#include "base/feature_list.h"
 #include "base/json/json_writer.h"
 #include "base/no_destructor.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "brave/common/brave_services_key.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
@@ -22,6 +24,7 @@
 #include "brave/components/brave_wallet/browser/eth_response_parser.h"
 #include "brave/components/brave_wallet/browser/fil_requests.h"
 #include "brave/components/brave_wallet/browser/fil_response_parser.h"
+#include "brave/components/brave_wallet/browser/json_rpc_request_batcher.h"
 #include "brave/components/brave_wallet/browser/json_rpc_response_parser.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
 #include "brave/components/brave_wallet/browser/solana_keyring.h"
@@ -31,6 +34,7 @@
 #include "brave/components/brave_wallet/common/brave_wallet_response_helpers.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
 #include "brave/components/brave_wallet/common/eth_request_helper.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
 #include "brave/components/brave_wallet/common/value_conversion_utils.h"
 #include "brave/components/brave_wallet/common/web3_provider_constants.h"
@@ -111,6 +115,24 @@ bool IsChainExist(PrefService* prefs, const std::string& chain_id) {
 
 }  // namespace ethereum
 
+// Identical in-flight requests for these methods must still each reach the
+// network, so their responses are never shared.
+bool IsTransactionSubmission(const std::string& method) {
+  return method == "eth_sendRawTransaction" ||
+         method == "eth_sendTransaction" || method == "sendTransaction" ||
+         method == "Filecoin.MpoolPush";
+}
+
+constexpr size_t kResponseCacheSize = 500;
+
+base::TimeDelta GetBatchWindow() {
+  if (!base::FeatureList::IsEnabled(
+          brave_wallet::features::kBraveWalletJsonRpcBatchingFeature))
+    return base::TimeDelta();
+  return base::Milliseconds(
+      brave_wallet::features::kBraveWalletJsonRpcBatchWindowMs.Get());
+}
+
 namespace solana {
 // https://github.com/solana-labs/solana/blob/f7b2951c79cd07685ed62717e78ab1c200924924/rpc/src/rpc.rs#L1717
 constexpr char kAccountNotCreatedError[] = "could not find account";
@@ -126,6 +148,14 @@ JsonRpcService::JsonRpcService(
     : api_request_helper_(new api_request_helper::APIRequestHelper(
           GetNetworkTrafficAnnotationTag(),
           url_loader_factory)),
+      request_batcher_(std::make_unique<JsonRpcRequestBatcher>(
+          api_request_helper_.get(),
+          GetBatchWindow())),
+      response_cache_(
+          base::FeatureList::IsEnabled(
+              features::kBraveWalletJsonRpcResponseCacheFeature)
+              ? std::make_unique<JsonRpcResponseCache>(kResponseCacheSize)
+              : nullptr),
       ud_get_eth_addr_calls_(
           std::make_unique<UnstoppableDomainsMultichainCalls<std::string>>()),
       prefs_(prefs),
@@ -145,6 +175,8 @@ void JsonRpcService::SetAPIRequestHelperForTesting(
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory) {
   api_request_helper_.reset(new api_request_helper::APIRequestHelper(
       GetNetworkTrafficAnnotationTag(), url_loader_factory));
+  request_batcher_ = std::make_unique<JsonRpcRequestBatcher>(
+      api_request_helper_.get(), GetBatchWindow());
 }
 
 JsonRpcService::~JsonRpcService() {}
@@ -220,10 +252,52 @@ void JsonRpcService::RequestInternal(
     env->GetVar("BRAVE_SERVICES_KEY", &brave_key);
   }
   request_headers["x-brave-key"] = std::move(brave_key);
-  api_request_helper_->Request("POST", network_url, json_payload,
-                               "application/json", auto_retry_on_network_change,
-                               std::move(callback), request_headers, -1u,
-                               std::move(conversion_callback));
+
+  absl::optional<JsonRpcResponseCache::Key> cache_key;
+  if (response_cache_)
+    cache_key = response_cache_->GetKey(network_url, json_payload);
+  if (cache_key) {
+    const JsonRpcResponseCache::Response* response =
+        response_cache_->Get(*cache_key);
+    if (response) {
+      // Callbacks may be bound to this service without a weak pointer, so
+      // they must not run once it is gone
+      base::SequencedTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE, base::BindOnce(&JsonRpcService::OnCachedResponse,
+                                    weak_ptr_factory_.GetWeakPtr(),
+                                    std::move(callback), *response));
+      return;
+    }
+    callback = base::BindOnce(&JsonRpcService::OnCacheableResponse,
+                              weak_ptr_factory_.GetWeakPtr(), *cache_key,
+                              std::move(callback));
+  }
+
+  const bool can_share_response =
+      base::FeatureList::IsEnabled(
+          brave_wallet::features::kBraveWalletJsonRpcBatchingFeature) &&
+      !method.empty() && !IsTransactionSubmission(method);
+  request_batcher_->Request(network_url, json_payload,
+                            auto_retry_on_network_change, request_headers,
+                            can_share_response, std::move(callback),
+                            std::move(conversion_callback));
+}
+
+void JsonRpcService::OnCacheableResponse(
+    const JsonRpcResponseCache::Key& cache_key,
+    RequestIntermediateCallback callback,
+    int status,
+    const std::string& body,
+    const base::flat_map<std::string, std::string>& headers) {
+  if (status >= 200 && status <= 299)
+    response_cache_->Put(cache_key, body, headers);
+  std::move(callback).Run(status, body, headers);
+}
+
+void JsonRpcService::OnCachedResponse(
+    RequestIntermediateCallback callback,
+    const JsonRpcResponseCache::Response& response) {
+  std::move(callback).Run(200, response.body, response.headers);
 }
 
 void JsonRpcService::Request(const std::string& json_payload,
@@ -534,11 +608,11 @@ void JsonRpcService::SetCustomNetworkForTesting(const std::string& chain_id,
 }
 
 void JsonRpcService::GetBlockNumber(GetBlockNumberCallback callback) {
-  auto internal_callback =
-      base::BindOnce(&JsonRpcService::OnGetBlockNumber,
-                     weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  RequestInternal(eth::eth_blockNumber(), true,
-                  network_urls_[mojom::CoinType::ETH],
+  const GURL& network_url = network_urls_[mojom::CoinType::ETH];
+  auto internal_callback = base::BindOnce(&JsonRpcService::OnGetBlockNumber,
+                                          weak_ptr_factory_.GetWeakPtr(),
+                                          std::move(callback), network_url);
+  RequestInternal(eth::eth_blockNumber(), true, network_url,
                   std::move(internal_callback));
 }
 
@@ -570,6 +644,7 @@ void JsonRpcService::OnGetFilStateSearchMsgLimited(
 
 void JsonRpcService::OnGetBlockNumber(
     GetBlockNumberCallback callback,
+    const GURL& network_url,
     const int status,
     const std::string& body,
     const base::flat_map<std::string, std::string>& headers) {
@@ -588,6 +663,9 @@ void JsonRpcService::OnGetBlockNumber(
     return;
   }
 
+  if (response_cache_)
+    response_cache_->OnNewBlock(network_url, block_number);
+
   std::move(callback).Run(block_number, mojom::ProviderError::kSuccess, "");
 }
 
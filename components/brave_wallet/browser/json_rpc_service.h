@@ -18,6 +18,7 @@
 #include "base/observer_list_threadsafe.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
+#include "brave/components/brave_wallet/browser/json_rpc_response_cache.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 #include "components/keyed_service/core/keyed_service.h"
@@ -37,6 +38,7 @@ class SimpleURLLoader;
 class PrefService;
 
 namespace brave_wallet {
+class JsonRpcRequestBatcher;
 template <class ResultType>
 class UnstoppableDomainsMultichainCalls;
 
@@ -356,6 +358,7 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
       const base::flat_map<std::string, std::string>& headers);
   void OnGetBlockNumber(
       GetBlockNumberCallback callback,
+      const GURL& network_url,
       const int status,
       const std::string& body,
       const base::flat_map<std::string, std::string>& headers);
@@ -477,6 +480,15 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
                        mojom::ProviderError error,
                        const std::string& error_message);
 
+  void OnCacheableResponse(
+      const JsonRpcResponseCache::Key& cache_key,
+      RequestIntermediateCallback callback,
+      int status,
+      const std::string& body,
+      const base::flat_map<std::string, std::string>& headers);
+  void OnCachedResponse(
+      RequestIntermediateCallback callback,
+      const JsonRpcResponseCache::Response& response);
   void RequestInternal(
       const std::string& json_payload,
       bool auto_retry_on_network_change,
@@ -584,6 +596,9 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
       const base::flat_map<std::string, std::string>& headers);
 
   std::unique_ptr<api_request_helper::APIRequestHelper> api_request_helper_;
+  std::unique_ptr<JsonRpcRequestBatcher> request_batcher_;
+  // Only set when kBraveWalletJsonRpcResponseCacheFeature is enabled
+  std::unique_ptr<JsonRpcResponseCache> response_cache_;
   base::flat_map<mojom::CoinType, GURL> network_urls_;
   // <mojom::CoinType, chain_id>
   base::flat_map<mojom::CoinType, std::string> chain_ids_;
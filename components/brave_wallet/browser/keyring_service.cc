@@ -5,10 +5,12 @@
 
 #include "brave/components/brave_wallet/browser/keyring_service.h"
 
+#include <algorithm>
 #include <string>
 #include <utility>
 
 #include "base/base64.h"
+#include "base/feature_list.h"
 #include "base/hash/hash.h"
 #include "base/logging.h"
 #include "base/strings/strcat.h"
@@ -29,6 +31,7 @@
 #include "brave/components/brave_wallet/common/brave_wallet.mojom-shared.h"
 #include "brave/components/brave_wallet/common/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
 #include "brave/components/brave_wallet/common/solana_utils.h"
 #include "components/grit/brave_components_strings.h"
@@ -136,6 +139,14 @@ const char kHardwareDerivationPath[] = "derivation_path";
 const char kSelectedAccount[] = "selected_account";
 const int kDiscoveryAttempts = 20;
 
+size_t GetDiscoveryRequestsLimit() {
+  if (!base::FeatureList::IsEnabled(
+          features::kBraveWalletParallelAccountDiscoveryFeature))
+    return 1;
+  return static_cast<size_t>(std::max(
+      1, features::kBraveWalletAccountDiscoveryRequestsInFlight.Get()));
+}
+
 mojom::CoinType GetCoinForKeyring(const std::string& keyring_id) {
   if (keyring_id == mojom::kFilecoinKeyringId) {
     return mojom::CoinType::FIL;
@@ -773,12 +784,11 @@ void KeyringService::RestoreWallet(const std::string& mnemonic,
   }
 
   if (keyring) {
-    discovery_weak_factory_.InvalidateWeakPtrs();
     // Start account discovery process. Consecutively look for accounts with at
     // least one transaction. Add such ones and all missing previous ones(so no
     // gaps). Stop discovering when there are 20 consecutive accounts with no
     // transactions.
-    AddDiscoveryAccountsForKeyring(1, kDiscoveryAttempts);
+    StartAccountDiscovery();
   }
 
   std::move(callback).Run(keyring);
@@ -1103,46 +1113,87 @@ void KeyringService::AddAccountForKeyring(const std::string& keyring_id,
       keyring->GetAddress(accounts_num - 1), keyring_id);
 }
 
-void KeyringService::AddDiscoveryAccountsForKeyring(
-    size_t discovery_account_index,
-    int attempts_left) {
-  if (attempts_left <= 0)
-    return;
+void KeyringService::StartAccountDiscovery() {
+  discovery_weak_factory_.InvalidateWeakPtrs();
+  discovery_next_request_index_ = 1;
+  discovery_next_result_index_ = 1;
+  discovery_attempts_left_ = kDiscoveryAttempts;
+  discovery_requests_in_flight_ = 0;
+  discovery_results_.clear();
+  RequestDiscoveryAccounts();
+}
+
+void KeyringService::RequestDiscoveryAccounts() {
   auto* keyring = GetHDKeyringById(mojom::kDefaultKeyringId);
   if (!keyring)
     return;
-  json_rpc_service_->GetEthTransactionCount(
-      keyring->GetDiscoveryAddress(discovery_account_index),
-      base::BindOnce(&KeyringService::OnGetTransactionCount,
-                     discovery_weak_factory_.GetWeakPtr(),
-                     discovery_account_index, attempts_left));
+
+  // Accounts past the remaining attempts are never needed unless a used
+  // account resets the attempts, so they are not requested yet.
+  const size_t requests_limit = GetDiscoveryRequestsLimit();
+  while (discovery_requests_in_flight_ < requests_limit &&
+         discovery_next_request_index_ <
+             discovery_next_result_index_ + discovery_attempts_left_) {
+    const size_t discovery_account_index = discovery_next_request_index_++;
+    discovery_requests_in_flight_++;
+    json_rpc_service_->GetEthTransactionCount(
+        keyring->GetDiscoveryAddress(discovery_account_index),
+        base::BindOnce(&KeyringService::OnGetTransactionCount,
+                       discovery_weak_factory_.GetWeakPtr(),
+                       discovery_account_index));
+  }
 }
 
 void KeyringService::OnGetTransactionCount(size_t discovery_account_index,
-                                           int attempts_left,
                                            uint256_t result,
                                            mojom::ProviderError error,
                                            const std::string& error_message) {
-  if (error != mojom::ProviderError::kSuccess)
-    return;
+  DCHECK_GT(discovery_requests_in_flight_, 0u);
+  discovery_requests_in_flight_--;
+  if (error != mojom::ProviderError::kSuccess) {
+    discovery_results_[discovery_account_index] = absl::nullopt;
+  } else {
+    discovery_results_[discovery_account_index] = result > 0;
+  }
+  ProcessDiscoveryResults();
+}
 
-  if (result > 0) {
-    auto* keyring = GetHDKeyringById(mojom::kDefaultKeyringId);
-    if (!keyring)
+void KeyringService::ProcessDiscoveryResults() {
+  while (discovery_attempts_left_ > 0) {
+    auto it = discovery_results_.find(discovery_next_result_index_);
+    if (it == discovery_results_.end()) {
+      RequestDiscoveryAccounts();
       return;
-    DCHECK_GT(keyring->GetAccountsNumber(), 0u);
-    size_t last_account_index = keyring->GetAccountsNumber() - 1;
-    if (discovery_account_index > last_account_index) {
-      AddAccountsWithDefaultName(discovery_account_index - last_account_index);
-      NotifyAccountsChanged();
     }
-
-    AddDiscoveryAccountsForKeyring(discovery_account_index + 1,
-                                   kDiscoveryAttempts);
-  } else {
-    AddDiscoveryAccountsForKeyring(discovery_account_index + 1,
-                                   attempts_left - 1);
+    const absl::optional<bool> has_transactions = it->second;
+    discovery_results_.erase(it);
+    const size_t discovery_account_index = discovery_next_result_index_++;
+
+    if (!has_transactions) {
+      discovery_attempts_left_ = 0;
+    } else if (*has_transactions) {
+      auto* keyring = GetHDKeyringById(mojom::kDefaultKeyringId);
+      if (!keyring) {
+        discovery_attempts_left_ = 0;
+        break;
+      }
+      DCHECK_GT(keyring->GetAccountsNumber(), 0u);
+      size_t last_account_index = keyring->GetAccountsNumber() - 1;
+      if (discovery_account_index > last_account_index) {
+        AddAccountsWithDefaultName(discovery_account_index -
+                                   last_account_index);
+        NotifyAccountsChanged();
+      }
+      discovery_attempts_left_ = kDiscoveryAttempts;
+    } else {
+      discovery_attempts_left_--;
+    }
   }
+
+  // Discovery is over, so drop the requests still in flight
+  discovery_weak_factory_.InvalidateWeakPtrs();
+  discovery_requests_in_flight_ = 0;
+  discovery_results_.clear();
 }
 
 absl::optional<std::string> KeyringService::ImportAccountForKeyring(
@@ -287,8 +287,14 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
 
   void AddAccountForKeyring(const std::string& keyring_id,
                             const std::string& account_name);
-  void AddDiscoveryAccountsForKeyring(size_t discovery_account_index,
-                                      int attempts_left);
+  // Looks for derived accounts of the default keyring with at least one
+  // transaction, keeping up to GetDiscoveryRequestsLimit() requests in flight.
+  // Results are handled in account order, so accounts are added without gaps
+  // and discovery stops after kDiscoveryAttempts consecutive unused accounts
+  // or the first failed request.
+  void StartAccountDiscovery();
+  void RequestDiscoveryAccounts();
+  void ProcessDiscoveryResults();
   mojom::KeyringInfoPtr GetKeyringInfoSync(const std::string& keyring_id);
   void OnAutoLockFired();
   HDKeyring* GetHDKeyringById(const std::string& keyring_id) const;
@@ -346,7 +352,6 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
   void SetSelectedAccountForCoin(mojom::CoinType coin,
                                  const std::string& address);
   void OnGetTransactionCount(size_t discovery_account_index,
-                             int attempts_left,
                              uint256_t result,
                              mojom::ProviderError error,
                              const std::string& error_message);
@@ -363,6 +368,14 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
   mojo::RemoteSet<mojom::KeyringServiceObserver> observers_;
   mojo::ReceiverSet<mojom::KeyringService> receivers_;
 
+  size_t discovery_next_request_index_ = 0;
+  size_t discovery_next_result_index_ = 0;
+  int discovery_attempts_left_ = 0;
+  size_t discovery_requests_in_flight_ = 0;
+  // Whether each discovery account has transactions, or absl::nullopt if the
+  // request failed. Only holds results not yet processed.
+  base::flat_map<size_t, absl::optional<bool>> discovery_results_;
+
   base::WeakPtrFactory<KeyringService> discovery_weak_factory_{this};
 
   KeyringService(const KeyringService&) = delete;
@@ -34,6 +34,8 @@ const char kSupportEip1559OnLocalhostChain[] =
     "brave.wallet.support_eip1559_on_localhost_chain";
 const char kBraveWalletEthereumTransactionsCoinTypeMigrated[] =
     "brave.wallet.ethereum_transactions.coin_type_migrated";
+const char kBraveWalletTransactionsDBMigrated[] =
+    "brave.wallet.transactions_db_migrated";
 
 // DEPRECATED
 const char kBraveWalletSelectedAccount[] = "brave.wallet.selected_account";
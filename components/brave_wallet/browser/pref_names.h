@@ -28,6 +28,9 @@ extern const char kSupportEip1559OnLocalhostChain[];
 // Added 02/2022 to migrate ethereum transactions to be under ethereum coin
 // type.
 extern const char kBraveWalletEthereumTransactionsCoinTypeMigrated[];
+// Added 05/2022 to move transactions from kBraveWalletTransactions to the
+// transactions database.
+extern const char kBraveWalletTransactionsDBMigrated[];
 
 // DEPRECATED
 extern const char kBraveWalletSelectedAccount[];
@@ -25,8 +25,11 @@ namespace brave_wallet {
 SolanaTxManager::SolanaTxManager(TxService* tx_service,
                                  JsonRpcService* json_rpc_service,
                                  KeyringService* keyring_service,
-                                 PrefService* prefs)
-    : TxManager(std::make_unique<SolanaTxStateManager>(prefs, json_rpc_service),
+                                 PrefService* prefs,
+                                 TxStore* tx_store)
+    : TxManager(std::make_unique<SolanaTxStateManager>(prefs,
+                                                       tx_store,
+                                                       json_rpc_service),
                 std::make_unique<SolanaBlockTracker>(json_rpc_service),
                 tx_service,
                 json_rpc_service,
@@ -21,6 +21,7 @@ class PrefService;
 namespace brave_wallet {
 
 class TxService;
+class TxStore;
 class JsonRpcService;
 class KeyringService;
 class SolanaTxMeta;
@@ -33,7 +34,8 @@ class SolanaTxManager : public TxManager, public SolanaBlockTracker::Observer {
   SolanaTxManager(TxService* tx_service,
                   JsonRpcService* json_rpc_service,
                   KeyringService* keyring_service,
-                  PrefService* prefs);
+                  PrefService* prefs,
+                  TxStore* tx_store);
   ~SolanaTxManager() override;
 
   // TxManager
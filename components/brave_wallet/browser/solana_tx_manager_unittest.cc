@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "base/files/file_path.h"
 #include "base/json/json_reader.h"
 #include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
@@ -67,7 +68,8 @@ class SolanaTxManagerUnitTest : public testing::Test {
     keyring_service_.reset(
         new KeyringService(json_rpc_service_.get(), &prefs_));
     tx_service_.reset(new TxService(json_rpc_service_.get(),
-                                    keyring_service_.get(), &prefs_));
+                                    keyring_service_.get(), &prefs_,
+                                    base::FilePath()));
     CreateWallet();
     AddAccount();
   }
@@ -15,8 +15,9 @@
 namespace brave_wallet {
 
 SolanaTxStateManager::SolanaTxStateManager(PrefService* prefs,
+                                           TxStore* tx_store,
                                            JsonRpcService* json_rpc_service)
-    : TxStateManager(prefs, json_rpc_service) {}
+    : TxStateManager(prefs, tx_store, json_rpc_service) {}
 
 SolanaTxStateManager::~SolanaTxStateManager() = default;
 
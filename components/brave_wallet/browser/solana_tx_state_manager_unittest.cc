@@ -16,6 +16,7 @@
 #include "brave/components/brave_wallet/browser/solana_instruction.h"
 #include "brave/components/brave_wallet/browser/solana_transaction.h"
 #include "brave/components/brave_wallet/browser/solana_tx_meta.h"
+#include "brave/components/brave_wallet/browser/tx_store.h"
 #include "brave/components/brave_wallet/common/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
@@ -39,8 +40,9 @@ class SolanaTxStateManagerUnitTest : public testing::Test {
     brave_wallet::RegisterProfilePrefs(prefs_.registry());
     json_rpc_service_.reset(
         new JsonRpcService(shared_url_loader_factory_, GetPrefs()));
-    solana_tx_state_manager_.reset(
-        new SolanaTxStateManager(GetPrefs(), json_rpc_service_.get()));
+    tx_store_ = std::make_unique<TxStore>(GetPrefs(), base::FilePath());
+    solana_tx_state_manager_.reset(new SolanaTxStateManager(
+        GetPrefs(), tx_store_.get(), json_rpc_service_.get()));
   }
 
   void SetNetwork(const std::string& chain_id) {
@@ -54,6 +56,7 @@ class SolanaTxStateManagerUnitTest : public testing::Test {
   scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
   std::unique_ptr<JsonRpcService> json_rpc_service_;
+  std::unique_ptr<TxStore> tx_store_;
   std::unique_ptr<SolanaTxStateManager> solana_tx_state_manager_;
 };
 
@@ -0,0 +1,236 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/tx_database.h"
+
+#include <tuple>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/logging.h"
+#include "sql/recovery.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr int kCurrentVersionNumber = 1;
+constexpr int kCompatibleVersionNumber = 1;
+
+void DatabaseErrorCallback(sql::Database* db,
+                           const base::FilePath& db_path,
+                           int extended_error,
+                           sql::Statement* stmt) {
+  if (sql::Recovery::ShouldRecover(extended_error)) {
+    // Prevent reentrant calls.
+    db->reset_error_callback();
+
+    // After this call, the |db| handle is poisoned so that future calls will
+    // return errors until the handle is re-opened.
+    sql::Recovery::RecoverDatabase(db, db_path);
+
+    // The ignored call signals the test-expectation framework that the error
+    // was handled.
+    std::ignore = sql::Database::IsExpectedSqliteError(extended_error);
+    return;
+  }
+
+  // The default handling is to assert on debug and to ignore on release.
+  if (!sql::Database::IsExpectedSqliteError(extended_error))
+    DLOG(FATAL) << db->GetErrorMessage();
+}
+
+}  // namespace
+
+absl::optional<TxLookupFields> GetTxLookupFields(const base::Value& value) {
+  absl::optional<int> status = value.FindIntKey("status");
+  const std::string* from = value.FindStringKey("from");
+  if (!status || !from)
+    return absl::nullopt;
+
+  const std::string* nonce = value.FindStringPath("tx.nonce");
+  return TxLookupFields{static_cast<mojom::TransactionStatus>(*status), *from,
+                        nonce ? *nonce : ""};
+}
+
+TxRecord::TxRecord() = default;
+TxRecord::TxRecord(const std::string& chain,
+                   const std::string& id,
+                   base::Value value)
+    : chain(chain), id(id), value(std::move(value)) {}
+TxRecord::TxRecord(TxRecord&&) = default;
+TxRecord& TxRecord::operator=(TxRecord&&) = default;
+TxRecord::~TxRecord() = default;
+
+TxDatabase::TxDatabase(const base::FilePath& db_path)
+    : db_({.exclusive_locking = true, .page_size = 4096, .cache_size = 128}),
+      db_path_(db_path) {}
+
+TxDatabase::~TxDatabase() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+}
+
+absl::optional<std::vector<TxRecord>> TxDatabase::Load() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!Init())
+    return absl::nullopt;
+
+  std::vector<TxRecord> records;
+  sql::Statement statement(
+      db_.GetUniqueStatement("SELECT chain, id, value FROM transactions"));
+  while (statement.Step()) {
+    absl::optional<base::Value> value =
+        base::JSONReader::Read(statement.ColumnString(2));
+    if (!value || !value->is_dict())
+      continue;
+    records.emplace_back(statement.ColumnString(0), statement.ColumnString(1),
+                         std::move(*value));
+  }
+  return records;
+}
+
+bool TxDatabase::AddOrUpdateTx(TxRecord record) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!db_.is_open())
+    return false;
+  return InsertOrReplace(record);
+}
+
+bool TxDatabase::AddOrUpdateTxs(std::vector<TxRecord> records) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!db_.is_open())
+    return false;
+
+  sql::Transaction transaction(&db_);
+  if (!transaction.Begin())
+    return false;
+  for (const auto& record : records) {
+    if (!InsertOrReplace(record))
+      return false;
+  }
+  return transaction.Commit();
+}
+
+bool TxDatabase::DeleteTx(const std::string& chain, const std::string& id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!db_.is_open())
+    return false;
+
+  sql::Statement statement(db_.GetCachedStatement(
+      SQL_FROM_HERE, "DELETE FROM transactions WHERE chain = ? AND id = ?"));
+  statement.BindString(0, chain);
+  statement.BindString(1, id);
+  return statement.Run();
+}
+
+bool TxDatabase::DeleteTxsForChain(const std::string& chain) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!db_.is_open())
+    return false;
+
+  sql::Statement statement(db_.GetCachedStatement(
+      SQL_FROM_HERE, "DELETE FROM transactions WHERE chain = ?"));
+  statement.BindString(0, chain);
+  return statement.Run();
+}
+
+bool TxDatabase::DeleteAllTxs() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!db_.is_open())
+    return false;
+  return db_.Execute("DELETE FROM transactions");
+}
+
+bool TxDatabase::Init() {
+  if (db_.is_open())
+    return true;
+
+  db_.set_histogram_tag("BraveWalletTransactions");
+
+  bool opened = false;
+  if (db_path_.empty()) {
+    opened = db_.OpenInMemory();
+  } else {
+    // To recover from corruption.
+    db_.set_error_callback(
+        base::BindRepeating(&DatabaseErrorCallback, &db_, db_path_));
+    opened = db_.Open(db_path_);
+  }
+  if (!opened)
+    return false;
+
+  if (!EnsureTable()) {
+    LOG(ERROR) << "Failed to initialize the wallet transactions database";
+    db_.Close();
+    return false;
+  }
+  return true;
+}
+
+bool TxDatabase::EnsureTable() {
+  sql::Transaction transaction(&db_);
+  if (!transaction.Begin())
+    return false;
+
+  if (!meta_table_.Init(&db_, kCurrentVersionNumber,
+                        kCompatibleVersionNumber)) {
+    return false;
+  }
+  if (meta_table_.GetCompatibleVersionNumber() > kCurrentVersionNumber) {
+    LOG(WARNING) << "Wallet transactions database is too new";
+    return false;
+  }
+
+  // |status|, |from_address| and |nonce| are copies of fields of |value|, the
+  // tx as JSON, so that txs can be looked up by them.
+  if (!db_.Execute("CREATE TABLE IF NOT EXISTS transactions ("
+                   "chain TEXT NOT NULL,"
+                   "id TEXT NOT NULL,"
+                   "status INTEGER NOT NULL,"
+                   "from_address TEXT NOT NULL,"
+                   "nonce TEXT NOT NULL,"
+                   "value TEXT NOT NULL,"
+                   "PRIMARY KEY (chain, id))") ||
+      !db_.Execute("CREATE INDEX IF NOT EXISTS transactions_status_index "
+                   "ON transactions (chain, status, from_address)") ||
+      !db_.Execute("CREATE INDEX IF NOT EXISTS transactions_nonce_index "
+                   "ON transactions (chain, nonce)")) {
+    return false;
+  }
+
+  return transaction.Commit();
+}
+
+bool TxDatabase::InsertOrReplace(const TxRecord& record) {
+  absl::optional<TxLookupFields> fields = GetTxLookupFields(record.value);
+  std::string json;
+  if (!fields || !base::JSONWriter::Write(record.value, &json))
+    return false;
+
+  sql::Statement statement(db_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "INSERT OR REPLACE INTO transactions "
+      "(chain, id, status, from_address, nonce, value) "
+      "VALUES (?, ?, ?, ?, ?, ?)"));
+  statement.BindString(0, record.chain);
+  statement.BindString(1, record.id);
+  statement.BindInt(2, static_cast<int>(fields->status));
+  statement.BindString(3, fields->from);
+  statement.BindString(4, fields->nonce);
+  statement.BindString(5, json);
+  return statement.Run();
+}
+
+}  // namespace brave_wallet
@@ -0,0 +1,85 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_DATABASE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_DATABASE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/sequence_checker.h"
+#include "base/values.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "sql/database.h"
+#include "sql/meta_table.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_wallet {
+
+// Fields of a tx value which txs are looked up by.
+struct TxLookupFields {
+  mojom::TransactionStatus status;
+  std::string from;
+  // As stored in the tx value, empty if the tx has no nonce.
+  std::string nonce;
+};
+
+// Returns nullopt if |value| has no status or from address. Such txs can't be
+// turned back into a TxMeta.
+absl::optional<TxLookupFields> GetTxLookupFields(const base::Value& value);
+
+// A tx as stored in the database. |chain| is the coin type and network id of
+// the tx, e.g. "ethereum.mainnet".
+struct TxRecord {
+  TxRecord();
+  TxRecord(const std::string& chain, const std::string& id, base::Value value);
+  TxRecord(TxRecord&&);
+  TxRecord& operator=(TxRecord&&);
+  ~TxRecord();
+
+  std::string chain;
+  std::string id;
+  base::Value value;
+};
+
+// Stores the txs of all coin types in a SQLite database, one row per tx, with
+// indices on their status, from address and nonce. Must be used on a sequence
+// which allows blocking, see TxStore.
+class TxDatabase {
+ public:
+  // An empty |db_path| keeps the database in memory.
+  explicit TxDatabase(const base::FilePath& db_path);
+  ~TxDatabase();
+  TxDatabase(const TxDatabase&) = delete;
+  TxDatabase& operator=(const TxDatabase&) = delete;
+
+  // Opens the database and returns every tx in it. Returns nullopt if the
+  // database can't be opened, in which case the other methods fail.
+  absl::optional<std::vector<TxRecord>> Load();
+
+  bool AddOrUpdateTx(TxRecord record);
+  // Adds or updates all of |records| in one transaction. Other stored txs are
+  // kept.
+  bool AddOrUpdateTxs(std::vector<TxRecord> records);
+  bool DeleteTx(const std::string& chain, const std::string& id);
+  bool DeleteTxsForChain(const std::string& chain);
+  bool DeleteAllTxs();
+
+ private:
+  bool Init();
+  bool EnsureTable();
+  bool InsertOrReplace(const TxRecord& record);
+
+  sql::Database db_;
+  sql::MetaTable meta_table_;
+  base::FilePath db_path_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_DATABASE_H_
@@ -12,6 +12,7 @@
 
 #include "base/containers/flat_map.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
@@ -21,6 +22,10 @@
 
 class PrefService;
 
+namespace base {
+class FilePath;
+}  // namespace base
+
 namespace brave_wallet {
 
 class JsonRpcService;
@@ -29,15 +34,19 @@ class TxManager;
 class EthTxManager;
 class SolanaTxManager;
 class FilTxManager;
+class TxStore;
 
 class TxService : public KeyedService,
                   public mojom::TxService,
                   public mojom::EthTxManagerProxy,
                   public mojom::SolanaTxManagerProxy {
  public:
+  // The txs are stored in a database under |context_path|, or in memory if it
+  // is empty.
   TxService(JsonRpcService* json_rpc_service,
             KeyringService* keyring_service,
-            PrefService* prefs);
+            PrefService* prefs,
+            const base::FilePath& context_path);
   ~TxService() override;
   TxService(const TxService&) = delete;
   TxService operator=(const TxService&) = delete;
@@ -173,6 +182,7 @@ class TxService : public KeyedService,
   FilTxManager* GetFilTxManager();
 
   raw_ptr<PrefService> prefs_;  // NOT OWNED
+  std::unique_ptr<TxStore> tx_store_;
   base::flat_map<mojom::CoinType, std::unique_ptr<TxManager>> tx_manager_map_;
   mojo::RemoteSet<mojom::TxServiceObserver> observers_;
   mojo::ReceiverSet<mojom::TxService> tx_service_receivers_;
@@ -9,10 +9,8 @@
 
 #include "base/json/values_util.h"
 #include "base/values.h"
-#include "brave/components/brave_wallet/browser/pref_names.h"
 #include "brave/components/brave_wallet/browser/tx_meta.h"
-#include "components/prefs/pref_service.h"
-#include "components/prefs/scoped_user_pref_update.h"
+#include "brave/components/brave_wallet/browser/tx_store.h"
 #include "url/origin.h"
 
 namespace brave_wallet {
@@ -83,20 +81,21 @@ bool TxStateManager::ValueToTxMeta(const base::Value& value, TxMeta* meta) {
 }
 
 TxStateManager::TxStateManager(PrefService* prefs,
+                               TxStore* tx_store,
                                JsonRpcService* json_rpc_service)
-    : prefs_(prefs), json_rpc_service_(json_rpc_service), weak_factory_(this) {
+    : prefs_(prefs),
+      tx_store_(tx_store),
+      json_rpc_service_(json_rpc_service),
+      weak_factory_(this) {
+  DCHECK(tx_store_);
   DCHECK(json_rpc_service_);
 }
 
 TxStateManager::~TxStateManager() = default;
 
 void TxStateManager::AddOrUpdateTx(const TxMeta& meta) {
-  DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
-  base::Value* dict = update.Get();
-  const std::string path = GetTxPrefPathPrefix() + "." + meta.id();
-
-  bool is_add = dict->FindPath(path) == nullptr;
-  dict->SetPath(path, meta.ToValue());
+  const bool is_add = tx_store_->AddOrUpdateTx(GetTxPrefPathPrefix(),
+                                               meta.id(), meta.ToValue());
   if (!is_add) {
     for (auto& observer : observers_)
       observer.OnTransactionStatusChanged(meta.ToTransactionInfo());
@@ -112,10 +111,7 @@ void TxStateManager::AddOrUpdateTx(const TxMeta& meta) {
 }
 
 std::unique_ptr<TxMeta> TxStateManager::GetTx(const std::string& id) {
-  const base::Value* dict = prefs_->GetDictionary(kBraveWalletTransactions);
-  if (!dict)
-    return nullptr;
-  const base::Value* value = dict->FindPath(GetTxPrefPathPrefix() + "." + id);
+  const base::Value* value = tx_store_->GetTx(GetTxPrefPathPrefix(), id);
   if (!value)
     return nullptr;
 
@@ -123,36 +119,35 @@ std::unique_ptr<TxMeta> TxStateManager::GetTx(const std::string& id) {
 }
 
 void TxStateManager::DeleteTx(const std::string& id) {
-  DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
-  base::Value* dict = update.Get();
-  dict->RemovePath(GetTxPrefPathPrefix() + "." + id);
+  tx_store_->DeleteTx(GetTxPrefPathPrefix(), id);
 }
 
 void TxStateManager::WipeTxs() {
-  DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
-  base::Value* dict = update.Get();
-  dict->RemovePath(GetTxPrefPathPrefix());
+  tx_store_->DeleteTxsForChain(GetTxPrefPathPrefix());
 }
 
 std::vector<std::unique_ptr<TxMeta>> TxStateManager::GetTransactionsByStatus(
     absl::optional<mojom::TransactionStatus> status,
     absl::optional<std::string> from) {
   std::vector<std::unique_ptr<TxMeta>> result;
-  const base::Value* dict = prefs_->GetDictionary(kBraveWalletTransactions);
-  const base::Value* network_dict = dict->FindPath(GetTxPrefPathPrefix());
-  if (!network_dict)
-    return result;
-
-  for (const auto it : network_dict->DictItems()) {
-    std::unique_ptr<TxMeta> meta = ValueToTxMeta(it.second);
-    if (!meta) {
-      continue;
-    }
-    if (!status.has_value() || meta->status() == *status) {
-      if (from.has_value() && meta->from() != *from)
-        continue;
+  const std::string chain = GetTxPrefPathPrefix();
+  for (const auto& id : tx_store_->GetTxIds(chain, status, from)) {
+    std::unique_ptr<TxMeta> meta = ValueToTxMeta(*tx_store_->GetTx(chain, id));
+    if (meta)
+      result.push_back(std::move(meta));
+  }
+  return result;
+}
+
+std::vector<std::unique_ptr<TxMeta>> TxStateManager::GetTransactionsByNonce(
+    const std::string& nonce,
+    absl::optional<mojom::TransactionStatus> status) {
+  std::vector<std::unique_ptr<TxMeta>> result;
+  const std::string chain = GetTxPrefPathPrefix();
+  for (const auto& id : tx_store_->GetTxIdsByNonce(chain, nonce)) {
+    std::unique_ptr<TxMeta> meta = ValueToTxMeta(*tx_store_->GetTx(chain, id));
+    if (meta && (!status || meta->status() == *status))
       result.push_back(std::move(meta));
-    }
   }
   return result;
 }
@@ -10,7 +10,6 @@
 #include <string>
 #include <vector>
 
-#include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
@@ -27,11 +26,14 @@ class Value;
 namespace brave_wallet {
 
 class TxMeta;
+class TxStore;
 class JsonRpcService;
 
 class TxStateManager {
  public:
-  TxStateManager(PrefService* prefs, JsonRpcService* json_rpc_service);
+  TxStateManager(PrefService* prefs,
+                 TxStore* tx_store,
+                 JsonRpcService* json_rpc_service);
   virtual ~TxStateManager();
   TxStateManager(const TxStateManager&) = delete;
 
@@ -43,6 +45,10 @@ class TxStateManager {
   std::vector<std::unique_ptr<TxMeta>> GetTransactionsByStatus(
       absl::optional<mojom::TransactionStatus> status,
       absl::optional<std::string> from);
+  // |nonce| is formatted as stored in the tx value.
+  std::vector<std::unique_ptr<TxMeta>> GetTransactionsByNonce(
+      const std::string& nonce,
+      absl::optional<mojom::TransactionStatus> status);
 
   class Observer : public base::CheckedObserver {
    public:
@@ -59,10 +65,10 @@ class TxStateManager {
   static bool ValueToTxMeta(const base::Value& value, TxMeta* tx_meta);
 
   raw_ptr<PrefService> prefs_ = nullptr;
+  raw_ptr<TxStore> tx_store_ = nullptr;
   raw_ptr<JsonRpcService> json_rpc_service_ = nullptr;
 
  private:
-  FRIEND_TEST_ALL_PREFIXES(TxStateManagerUnitTest, TxOperations);
   void RetireTxByStatus(mojom::TransactionStatus status, size_t max_num);
 
   // Each derived class should implement its own ValueToTxMeta to create a
@@ -72,8 +78,7 @@ class TxStateManager {
 
   // Each derived class should provide transaction pref path prefix as
   // coin_type.network_id. For example, ethereum.mainnet or solana.testnet.
-  // This will be used to get/set the transaction pref for a specific
-  // coin_type.
+  // This is the chain its txs are stored under in TxStore.
   virtual std::string GetTxPrefPathPrefix() = 0;
 
   base::ObserverList<Observer> observers_;
@@ -5,18 +5,22 @@
 
 #include "brave/components/brave_wallet/browser/tx_state_manager.h"
 
+#include "base/files/file_path.h"
 #include "base/run_loop.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "base/time/time.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
+#include "brave/components/brave_wallet/browser/eth_transaction.h"
 #include "brave/components/brave_wallet/browser/eth_tx_meta.h"
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
-#include "brave/components/brave_wallet/browser/pref_names.h"
+#include "brave/components/brave_wallet/browser/tx_store.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "brave/components/brave_wallet/common/brave_wallet_types.h"
 #include "components/prefs/pref_service.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
 #include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
@@ -85,8 +89,9 @@ class TxStateManagerUnitTest : public testing::Test {
     // The only different between each coin type's tx state manager in these
     // base functions are their pref paths, so here we just use
     // EthTxStateManager to test common methods in TxStateManager.
-    tx_state_manager_.reset(
-        new EthTxStateManager(&prefs_, json_rpc_service_.get()));
+    tx_store_ = std::make_unique<TxStore>(&prefs_, base::FilePath());
+    tx_state_manager_.reset(new EthTxStateManager(&prefs_, tx_store_.get(),
+                                                  json_rpc_service_.get()));
   }
 
   void SetNetwork(const std::string& chain_id, mojom::CoinType coin) {
@@ -102,29 +107,24 @@ class TxStateManagerUnitTest : public testing::Test {
   scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
   std::unique_ptr<JsonRpcService> json_rpc_service_;
+  std::unique_ptr<TxStore> tx_store_;
   std::unique_ptr<TxStateManager> tx_state_manager_;
 };
 
 TEST_F(TxStateManagerUnitTest, TxOperations) {
-  prefs_.ClearPref(kBraveWalletTransactions);
-
   EthTxMeta meta;
   meta.set_id("001");
-  EXPECT_FALSE(prefs_.HasPrefPath(kBraveWalletTransactions));
+  EXPECT_TRUE(tx_store_->GetTxIds("ethereum.mainnet", absl::nullopt,
+                                  absl::nullopt)
+                  .empty());
   // Add
   tx_state_manager_->AddOrUpdateTx(meta);
-  EXPECT_TRUE(prefs_.HasPrefPath(kBraveWalletTransactions));
   {
-    const auto* dict = prefs_.GetDictionary(kBraveWalletTransactions);
-    ASSERT_TRUE(dict);
-    EXPECT_EQ(dict->DictSize(), 1u);
-    const auto* ethereum_dict = dict->FindKey("ethereum");
-    ASSERT_TRUE(ethereum_dict);
-    EXPECT_EQ(ethereum_dict->DictSize(), 1u);
-    const auto* network_dict = ethereum_dict->FindKey("mainnet");
-    ASSERT_TRUE(network_dict);
-    EXPECT_EQ(network_dict->DictSize(), 1u);
-    const base::Value* value = network_dict->FindKey("001");
+    EXPECT_EQ(tx_store_->GetTxIds("ethereum.mainnet", absl::nullopt,
+                                  absl::nullopt)
+                  .size(),
+              1u);
+    const base::Value* value = tx_store_->GetTx("ethereum.mainnet", "001");
     ASSERT_TRUE(value);
     auto meta_from_value = tx_state_manager_->ValueToTxMeta(*value);
     ASSERT_NE(meta_from_value, nullptr);
@@ -135,16 +135,11 @@ TEST_F(TxStateManagerUnitTest, TxOperations) {
   // Update
   tx_state_manager_->AddOrUpdateTx(meta);
   {
-    const auto* dict = prefs_.GetDictionary(kBraveWalletTransactions);
-    ASSERT_TRUE(dict);
-    EXPECT_EQ(dict->DictSize(), 1u);
-    const auto* ethereum_dict = dict->FindKey("ethereum");
-    ASSERT_TRUE(ethereum_dict);
-    EXPECT_EQ(ethereum_dict->DictSize(), 1u);
-    const auto* network_dict = ethereum_dict->FindKey("mainnet");
-    ASSERT_TRUE(network_dict);
-    EXPECT_EQ(network_dict->DictSize(), 1u);
-    const base::Value* value = network_dict->FindKey("001");
+    EXPECT_EQ(tx_store_->GetTxIds("ethereum.mainnet", absl::nullopt,
+                                  absl::nullopt)
+                  .size(),
+              1u);
+    const base::Value* value = tx_store_->GetTx("ethereum.mainnet", "001");
     ASSERT_TRUE(value);
     auto meta_from_value = tx_state_manager_->ValueToTxMeta(*value);
     ASSERT_NE(meta_from_value, nullptr);
@@ -155,17 +150,10 @@ TEST_F(TxStateManagerUnitTest, TxOperations) {
   meta.set_tx_hash("0xabff");
   // Add another one
   tx_state_manager_->AddOrUpdateTx(meta);
-  {
-    const auto* dict = prefs_.GetDictionary(kBraveWalletTransactions);
-    ASSERT_TRUE(dict);
-    EXPECT_EQ(dict->DictSize(), 1u);
-    const auto* ethereum_dict = dict->FindKey("ethereum");
-    ASSERT_TRUE(ethereum_dict);
-    EXPECT_EQ(ethereum_dict->DictSize(), 1u);
-    const auto* network_dict = ethereum_dict->FindKey("mainnet");
-    ASSERT_TRUE(network_dict);
-    EXPECT_EQ(network_dict->DictSize(), 2u);
-  }
+  EXPECT_EQ(
+      tx_store_->GetTxIds("ethereum.mainnet", absl::nullopt, absl::nullopt)
+          .size(),
+      2u);
 
   // Get
   {
@@ -186,28 +174,17 @@ TEST_F(TxStateManagerUnitTest, TxOperations) {
 
   // Delete
   tx_state_manager_->DeleteTx("001");
-  {
-    const auto* dict = prefs_.GetDictionary(kBraveWalletTransactions);
-    ASSERT_TRUE(dict);
-    EXPECT_EQ(dict->DictSize(), 1u);
-    const auto* ethereum_dict = dict->FindKey("ethereum");
-    ASSERT_TRUE(ethereum_dict);
-    EXPECT_EQ(ethereum_dict->DictSize(), 1u);
-    const auto* network_dict = ethereum_dict->FindKey("mainnet");
-    ASSERT_TRUE(network_dict);
-    EXPECT_EQ(network_dict->DictSize(), 1u);
-  }
+  EXPECT_FALSE(tx_store_->GetTx("ethereum.mainnet", "001"));
+  EXPECT_TRUE(tx_store_->GetTx("ethereum.mainnet", "002"));
 
   // Purge
   tx_state_manager_->WipeTxs();
-  EXPECT_TRUE(prefs_.HasPrefPath(kBraveWalletTransactions));
-  EXPECT_FALSE(
-      prefs_.HasPrefPath(std::string(kBraveWalletTransactions) + ".ethereum"));
+  EXPECT_TRUE(tx_store_->GetTxIds("ethereum.mainnet", absl::nullopt,
+                                  absl::nullopt)
+                  .empty());
 }
 
 TEST_F(TxStateManagerUnitTest, GetTransactionsByStatus) {
-  prefs_.ClearPref(kBraveWalletTransactions);
-
   std::string addr1 = "0x3535353535353535353535353535353535353535";
   std::string addr2 = "0x2f015c60e0be116b1f0cd534704db9c92118fb6a";
 
@@ -280,8 +257,6 @@ TEST_F(TxStateManagerUnitTest, GetTransactionsByStatus) {
 }
 
 TEST_F(TxStateManagerUnitTest, SwitchNetwork) {
-  prefs_.ClearPref(kBraveWalletTransactions);
-
   EthTxMeta meta;
   meta.set_id("001");
   tx_state_manager_->AddOrUpdateTx(meta);
@@ -298,33 +273,16 @@ TEST_F(TxStateManagerUnitTest, SwitchNetwork) {
   EXPECT_EQ(tx_state_manager_->GetTx("001"), nullptr);
   tx_state_manager_->AddOrUpdateTx(meta);
 
-  const auto* dict = prefs_.GetDictionary(kBraveWalletTransactions);
-  ASSERT_TRUE(dict);
-  EXPECT_EQ(dict->DictSize(), 1u);
-  const auto* ethereum_dict = dict->FindKey("ethereum");
-  ASSERT_TRUE(ethereum_dict);
-  EXPECT_EQ(ethereum_dict->DictSize(), 3u);
-  const auto* mainnet_dict = ethereum_dict->FindKey("mainnet");
-  ASSERT_TRUE(mainnet_dict);
-  EXPECT_EQ(mainnet_dict->DictSize(), 1u);
-  EXPECT_TRUE(mainnet_dict->FindKey("001"));
-  const auto* ropsten_dict = ethereum_dict->FindKey("ropsten");
-  ASSERT_TRUE(ropsten_dict);
-  EXPECT_EQ(ropsten_dict->DictSize(), 1u);
-  EXPECT_TRUE(ropsten_dict->FindKey("001"));
+  EXPECT_TRUE(tx_store_->GetTx("ethereum.mainnet", "001"));
+  EXPECT_TRUE(tx_store_->GetTx("ethereum.ropsten", "001"));
   auto localhost_url_spec =
       brave_wallet::GetNetworkURL(&prefs_, mojom::kLocalhostChainId,
                                   mojom::CoinType::ETH)
           .spec();
-  const auto* localhost_dict = ethereum_dict->FindKey(localhost_url_spec);
-  ASSERT_TRUE(localhost_dict);
-  EXPECT_EQ(localhost_dict->DictSize(), 1u);
-  EXPECT_TRUE(localhost_dict->FindKey("001"));
+  EXPECT_TRUE(tx_store_->GetTx("ethereum." + localhost_url_spec, "001"));
 }
 
 TEST_F(TxStateManagerUnitTest, RetireOldTxMeta) {
-  prefs_.ClearPref(kBraveWalletTransactions);
-
   for (size_t i = 0; i < 20; ++i) {
     EthTxMeta meta;
     meta.set_id(base::NumberToString(i));
@@ -366,6 +324,89 @@ TEST_F(TxStateManagerUnitTest, RetireOldTxMeta) {
   EXPECT_TRUE(tx_state_manager_->GetTx("3"));
 }
 
+TEST_F(TxStateManagerUnitTest, TxIndex) {
+  const std::string addr1 = "0x3535353535353535353535353535353535353535";
+  const std::string addr2 = "0x2f015c60e0be116b1f0cd534704db9c92118fb6a";
+
+  EthTxMeta meta1;
+  meta1.set_id("001");
+  meta1.set_from(addr1);
+  meta1.set_status(mojom::TransactionStatus::Submitted);
+  tx_state_manager_->AddOrUpdateTx(meta1);
+
+  EthTxMeta meta2;
+  meta2.set_id("002");
+  meta2.set_from(addr2);
+  meta2.set_status(mojom::TransactionStatus::Submitted);
+  tx_state_manager_->AddOrUpdateTx(meta2);
+
+  // A status change moves the tx to the other status
+  meta1.set_status(mojom::TransactionStatus::Confirmed);
+  tx_state_manager_->AddOrUpdateTx(meta1);
+  auto submitted = tx_state_manager_->GetTransactionsByStatus(
+      mojom::TransactionStatus::Submitted, absl::nullopt);
+  ASSERT_EQ(submitted.size(), 1u);
+  EXPECT_EQ(submitted[0]->id(), "002");
+  auto confirmed = tx_state_manager_->GetTransactionsByStatus(
+      mojom::TransactionStatus::Confirmed, addr1);
+  ASSERT_EQ(confirmed.size(), 1u);
+  EXPECT_EQ(confirmed[0]->id(), "001");
+
+  tx_state_manager_->DeleteTx("002");
+  EXPECT_TRUE(tx_state_manager_
+                  ->GetTransactionsByStatus(mojom::TransactionStatus::Submitted,
+                                            absl::nullopt)
+                  .empty());
+
+  // Txs of another chain are not returned
+  tx_store_->AddOrUpdateTx("solana.mainnet", "004", meta1.ToValue());
+  confirmed = tx_state_manager_->GetTransactionsByStatus(
+      mojom::TransactionStatus::Confirmed, absl::nullopt);
+  ASSERT_EQ(confirmed.size(), 1u);
+  EXPECT_EQ(confirmed[0]->id(), "001");
+
+  tx_state_manager_->WipeTxs();
+  EXPECT_TRUE(
+      tx_state_manager_->GetTransactionsByStatus(absl::nullopt, absl::nullopt)
+          .empty());
+  EXPECT_TRUE(tx_store_->GetTx("solana.mainnet", "004"));
+}
+
+TEST_F(TxStateManagerUnitTest, GetTransactionsByNonce) {
+  for (size_t i = 0; i < 4; ++i) {
+    EthTxMeta meta;
+    meta.set_id(base::NumberToString(i));
+    meta.set_status(i % 2 == 0 ? mojom::TransactionStatus::Confirmed
+                               : mojom::TransactionStatus::Submitted);
+    auto tx = std::make_unique<EthTransaction>();
+    tx->set_nonce(uint256_t(i / 2));
+    meta.set_tx(std::move(tx));
+    tx_state_manager_->AddOrUpdateTx(meta);
+  }
+  // No nonce
+  EthTxMeta meta;
+  meta.set_id("4");
+  meta.set_status(mojom::TransactionStatus::Confirmed);
+  tx_state_manager_->AddOrUpdateTx(meta);
+
+  auto nonce0 = tx_state_manager_->GetTransactionsByNonce("0x0", absl::nullopt);
+  ASSERT_EQ(nonce0.size(), 2u);
+  EXPECT_EQ(nonce0[0]->id(), "0");
+  EXPECT_EQ(nonce0[1]->id(), "1");
+
+  auto confirmed_nonce1 = tx_state_manager_->GetTransactionsByNonce(
+      "0x1", mojom::TransactionStatus::Confirmed);
+  ASSERT_EQ(confirmed_nonce1.size(), 1u);
+  EXPECT_EQ(confirmed_nonce1[0]->id(), "2");
+
+  auto no_nonce = tx_state_manager_->GetTransactionsByNonce("", absl::nullopt);
+  ASSERT_EQ(no_nonce.size(), 1u);
+  EXPECT_EQ(no_nonce[0]->id(), "4");
+
+  EXPECT_TRUE(
+      tx_state_manager_->GetTransactionsByNonce("0x2", absl::nullopt).empty());
+}
+
 TEST_F(TxStateManagerUnitTest, Observer) {
   TestTxStateManagerObserver observer;
   tx_state_manager_->AddObserver(&observer);
@@ -0,0 +1,335 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/tx_store.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "base/bind.h"
+#include "base/containers/contains.h"
+#include "base/logging.h"
+#include "base/strings/strcat.h"
+#include "base/task/thread_pool.h"
+#include "brave/components/brave_wallet/browser/pref_names.h"
+#include "components/prefs/pref_service.h"
+#include "components/prefs/scoped_user_pref_update.h"
+
+namespace brave_wallet {
+
+TxStore::TxEntry::TxEntry(TxLookupFields fields, base::Value value)
+    : fields(std::move(fields)), value(std::move(value)) {}
+TxStore::TxEntry::TxEntry(TxEntry&&) = default;
+TxStore::TxEntry& TxStore::TxEntry::operator=(TxEntry&&) = default;
+TxStore::TxEntry::~TxEntry() = default;
+
+TxStore::TxStore(PrefService* prefs, const base::FilePath& db_path)
+    : prefs_(prefs),
+      database_(base::ThreadPool::CreateSequencedTaskRunner(
+                    {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+                     base::TaskShutdownBehavior::BLOCK_SHUTDOWN}),
+                db_path) {
+  DCHECK(prefs_);
+  database_.AsyncCall(&TxDatabase::Load)
+      .Then(base::BindOnce(&TxStore::OnLoaded, weak_factory_.GetWeakPtr()));
+}
+
+TxStore::~TxStore() = default;
+
+void TxStore::RunWhenLoaded(base::OnceClosure task) {
+  loaded_.Post(FROM_HERE, std::move(task));
+}
+
+bool TxStore::AddOrUpdateTx(const std::string& chain,
+                            const std::string& id,
+                            base::Value value) {
+  absl::optional<TxLookupFields> fields = GetTxLookupFields(value);
+  if (!fields) {
+    NOTREACHED() << "Tx values must have a status and a from address";
+    return false;
+  }
+
+  bool is_add = true;
+  auto chain_it = txs_.find(chain);
+  if (chain_it != txs_.end()) {
+    auto it = chain_it->second.find(id);
+    if (it != chain_it->second.end()) {
+      is_add = false;
+      RemoveFromIndices(chain, id, it->second.fields);
+      chain_it->second.erase(it);
+    }
+  }
+
+  if (storage_ == Storage::kPrefs) {
+    DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
+    update->SetPath(base::StrCat({chain, ".", id}), value.Clone());
+  } else if (storage_ == Storage::kDatabase) {
+    database_.AsyncCall(&TxDatabase::AddOrUpdateTx)
+        .WithArgs(TxRecord(chain, id, value.Clone()))
+        .Then(base::BindOnce(&TxStore::OnDatabaseWritten,
+                             weak_factory_.GetWeakPtr()));
+  }
+  AddEntry(chain, id, std::move(*fields), std::move(value));
+  return is_add;
+}
+
+const base::Value* TxStore::GetTx(const std::string& chain,
+                                  const std::string& id) const {
+  auto chain_it = txs_.find(chain);
+  if (chain_it == txs_.end())
+    return nullptr;
+  auto it = chain_it->second.find(id);
+  if (it == chain_it->second.end())
+    return nullptr;
+  return &it->second.value;
+}
+
+void TxStore::DeleteTx(const std::string& chain, const std::string& id) {
+  if (!is_loaded())
+    txs_deleted_before_load_.emplace(chain, id);
+  if (storage_ == Storage::kPrefs) {
+    DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
+    update->RemovePath(base::StrCat({chain, ".", id}));
+  } else if (storage_ == Storage::kDatabase) {
+    database_.AsyncCall(&TxDatabase::DeleteTx)
+        .WithArgs(chain, id)
+        .Then(base::BindOnce(&TxStore::OnDatabaseWritten,
+                             weak_factory_.GetWeakPtr()));
+  }
+
+  auto chain_it = txs_.find(chain);
+  if (chain_it == txs_.end())
+    return;
+  auto it = chain_it->second.find(id);
+  if (it == chain_it->second.end())
+    return;
+  RemoveFromIndices(chain, id, it->second.fields);
+  chain_it->second.erase(it);
+  if (chain_it->second.empty())
+    txs_.erase(chain_it);
+}
+
+void TxStore::DeleteTxsForChain(const std::string& chain) {
+  if (!is_loaded())
+    chains_deleted_before_load_.insert(chain);
+  if (storage_ == Storage::kPrefs) {
+    DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
+    update->RemovePath(chain);
+  } else if (storage_ == Storage::kDatabase) {
+    database_.AsyncCall(&TxDatabase::DeleteTxsForChain)
+        .WithArgs(chain)
+        .Then(base::BindOnce(&TxStore::OnDatabaseWritten,
+                             weak_factory_.GetWeakPtr()));
+  }
+
+  auto chain_it = txs_.find(chain);
+  if (chain_it == txs_.end())
+    return;
+  for (const auto& tx : chain_it->second)
+    RemoveFromIndices(chain, tx.first, tx.second.fields);
+  txs_.erase(chain_it);
+}
+
+void TxStore::DeleteAllTxs() {
+  if (!is_loaded())
+    all_deleted_before_load_ = true;
+  if (storage_ == Storage::kPrefs) {
+    prefs_->ClearPref(kBraveWalletTransactions);
+  } else if (storage_ == Storage::kDatabase) {
+    database_.AsyncCall(&TxDatabase::DeleteAllTxs)
+        .Then(base::BindOnce(&TxStore::OnDatabaseWritten,
+                             weak_factory_.GetWeakPtr()));
+  }
+
+  txs_.clear();
+  ids_by_status_.clear();
+  ids_by_nonce_.clear();
+}
+
+std::vector<std::string> TxStore::GetTxIds(
+    const std::string& chain,
+    absl::optional<mojom::TransactionStatus> status,
+    const absl::optional<std::string>& from) const {
+  std::vector<std::string> ids;
+  if (status && from) {
+    auto it = ids_by_status_.find(StatusKey(chain, *status, *from));
+    if (it != ids_by_status_.end())
+      ids.assign(it->second.begin(), it->second.end());
+    return ids;
+  }
+
+  if (status) {
+    for (auto it = ids_by_status_.lower_bound(StatusKey(chain, *status, ""));
+         it != ids_by_status_.end() && std::get<0>(it->first) == chain &&
+         std::get<1>(it->first) == *status;
+         ++it) {
+      ids.insert(ids.end(), it->second.begin(), it->second.end());
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  auto chain_it = txs_.find(chain);
+  if (chain_it == txs_.end())
+    return ids;
+  for (const auto& tx : chain_it->second) {
+    if (!from || tx.second.fields.from == *from)
+      ids.push_back(tx.first);
+  }
+  return ids;
+}
+
+std::vector<std::string> TxStore::GetTxIdsByNonce(
+    const std::string& chain,
+    const std::string& nonce) const {
+  auto it = ids_by_nonce_.find(NonceKey(chain, nonce));
+  if (it == ids_by_nonce_.end())
+    return {};
+  return std::vector<std::string>(it->second.begin(), it->second.end());
+}
+
+void TxStore::AddEntry(const std::string& chain,
+                       const std::string& id,
+                       TxLookupFields fields,
+                       base::Value value) {
+  ids_by_status_[StatusKey(chain, fields.status, fields.from)].insert(id);
+  ids_by_nonce_[NonceKey(chain, fields.nonce)].insert(id);
+  txs_[chain].emplace(id, TxEntry(std::move(fields), std::move(value)));
+}
+
+void TxStore::RemoveFromIndices(const std::string& chain,
+                                const std::string& id,
+                                const TxLookupFields& fields) {
+  auto status_it =
+      ids_by_status_.find(StatusKey(chain, fields.status, fields.from));
+  if (status_it != ids_by_status_.end()) {
+    status_it->second.erase(id);
+    if (status_it->second.empty())
+      ids_by_status_.erase(status_it);
+  }
+
+  auto nonce_it = ids_by_nonce_.find(NonceKey(chain, fields.nonce));
+  if (nonce_it != ids_by_nonce_.end()) {
+    nonce_it->second.erase(id);
+    if (nonce_it->second.empty())
+      ids_by_nonce_.erase(nonce_it);
+  }
+}
+
+void TxStore::OnLoaded(absl::optional<std::vector<TxRecord>> records) {
+  if (!records)
+    LOG(ERROR) << "Failed to open the wallet transactions database";
+
+  // The first of each tx wins: changes made before loading, then the pref,
+  // which holds the latest copy of every tx until they have been moved to the
+  // database, then the database.
+  const bool migrated = prefs_->GetBoolean(kBraveWalletTransactionsDBMigrated);
+  std::vector<TxRecord> stored;
+  if (!migrated)
+    stored = ReadTxsFromPrefs();
+  if (records)
+    std::move(records->begin(), records->end(), std::back_inserter(stored));
+
+  if (!all_deleted_before_load_) {
+    for (auto& record : stored) {
+      if (base::Contains(chains_deleted_before_load_, record.chain) ||
+          base::Contains(txs_deleted_before_load_,
+                         std::make_pair(record.chain, record.id)) ||
+          GetTx(record.chain, record.id)) {
+        continue;
+      }
+      absl::optional<TxLookupFields> fields =
+          GetTxLookupFields(record.value);
+      if (!fields)
+        continue;
+      AddEntry(record.chain, record.id, std::move(*fields),
+               std::move(record.value));
+    }
+  }
+  txs_deleted_before_load_.clear();
+  chains_deleted_before_load_.clear();
+  all_deleted_before_load_ = false;
+
+  // Changes made before loading were sent to the database, so they are kept
+  // by writing every tx, either to the pref or to the database. Once migrated
+  // though, the txs on disk are only in the database, and writing the pref
+  // would hide them on the next start, so nothing is written this session.
+  if (!records && migrated)
+    storage_ = Storage::kMemory;
+  else if (!records)
+    FallBackToPrefs();
+  else if (!migrated)
+    MigrateFromPrefs();
+  loaded_.Signal();
+}
+
+std::vector<TxRecord> TxStore::ReadTxsFromPrefs() const {
+  // The pref is keyed by coin type, then network id, then tx id.
+  std::vector<TxRecord> records;
+  const base::Value* transactions =
+      prefs_->GetDictionary(kBraveWalletTransactions);
+  for (const auto coin : transactions->DictItems()) {
+    if (!coin.second.is_dict())
+      continue;
+    for (const auto network : coin.second.DictItems()) {
+      if (!network.second.is_dict())
+        continue;
+      const std::string chain = coin.first + "." + network.first;
+      for (const auto tx : network.second.DictItems())
+        records.emplace_back(chain, tx.first, tx.second.Clone());
+    }
+  }
+  return records;
+}
+
+void TxStore::MigrateFromPrefs() {
+  std::vector<TxRecord> records;
+  for (const auto& chain : txs_) {
+    for (const auto& tx : chain.second)
+      records.emplace_back(chain.first, tx.first, tx.second.value.Clone());
+  }
+
+  database_.AsyncCall(&TxDatabase::AddOrUpdateTxs)
+      .WithArgs(std::move(records))
+      .Then(base::BindOnce(&TxStore::OnMigratedFromPrefs,
+                           weak_factory_.GetWeakPtr()));
+}
+
+void TxStore::OnMigratedFromPrefs(bool success) {
+  if (!success) {
+    LOG(ERROR) << "Failed to move wallet transactions out of prefs";
+    FallBackToPrefs();
+    return;
+  }
+  if (storage_ != Storage::kDatabase)
+    return;
+  prefs_->ClearPref(kBraveWalletTransactions);
+  prefs_->SetBoolean(kBraveWalletTransactionsDBMigrated, true);
+}
+
+void TxStore::OnDatabaseWritten(bool success) {
+  if (!success) {
+    LOG(ERROR) << "Failed to write to the wallet transactions database";
+    FallBackToPrefs();
+  }
+}
+
+void TxStore::FallBackToPrefs() {
+  if (storage_ != Storage::kDatabase)
+    return;
+  storage_ = Storage::kPrefs;
+
+  base::Value transactions(base::Value::Type::DICTIONARY);
+  for (const auto& chain : txs_) {
+    for (const auto& tx : chain.second) {
+      transactions.SetPath(base::StrCat({chain.first, ".", tx.first}),
+                           tx.second.value.Clone());
+    }
+  }
+  prefs_->Set(kBraveWalletTransactions, std::move(transactions));
+  prefs_->SetBoolean(kBraveWalletTransactionsDBMigrated, false);
+}
+
+}  // namespace brave_wallet
@@ -0,0 +1,142 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORE_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/files/file_path.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/one_shot_event.h"
+#include "base/threading/sequence_bound.h"
+#include "base/values.h"
+#include "brave/components/brave_wallet/browser/tx_database.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+class PrefService;
+
+namespace brave_wallet {
+
+// Holds the txs of all coin types, keyed by chain and id. |chain| is the coin
+// type and network id of a tx, e.g. "ethereum.mainnet". Every change is
+// written to a TxDatabase row by row on a background sequence, and txs are
+// indexed by status and from address, and by nonce, so lookups don't scan
+// every stored tx.
+//
+// The txs on disk are loaded asynchronously. Changes made before that are
+// kept over the loaded txs. Once loaded, txs still stored in the
+// kBraveWalletTransactions pref are moved to the database, once.
+//
+// If the database can't be opened or written to, all txs are written back to
+// the pref, which is used instead from then on, and merged into the database
+// again on the next start. Once the txs have been moved though, a database
+// that can't be opened isn't replaced by the pref: changes are then only kept
+// in memory until the next start.
+class TxStore {
+ public:
+  // An empty |db_path| keeps the database in memory.
+  TxStore(PrefService* prefs, const base::FilePath& db_path);
+  ~TxStore();
+  TxStore(const TxStore&) = delete;
+  TxStore& operator=(const TxStore&) = delete;
+
+  bool is_loaded() const { return loaded_.is_signaled(); }
+  // Runs |task| once the txs on disk have been loaded.
+  void RunWhenLoaded(base::OnceClosure task);
+
+  // Returns true if there was no tx with |id| yet.
+  bool AddOrUpdateTx(const std::string& chain,
+                     const std::string& id,
+                     base::Value value);
+  const base::Value* GetTx(const std::string& chain,
+                           const std::string& id) const;
+  void DeleteTx(const std::string& chain, const std::string& id);
+  void DeleteTxsForChain(const std::string& chain);
+  void DeleteAllTxs();
+
+  // Ids of the txs of |chain| with |status| and |from|, where given, sorted.
+  std::vector<std::string> GetTxIds(
+      const std::string& chain,
+      absl::optional<mojom::TransactionStatus> status,
+      const absl::optional<std::string>& from) const;
+  // Ids of the txs of |chain| with |nonce|, as stored in the tx value.
+  std::vector<std::string> GetTxIdsByNonce(const std::string& chain,
+                                           const std::string& nonce) const;
+
+ private:
+  struct TxEntry {
+    TxEntry(TxLookupFields fields, base::Value value);
+    TxEntry(TxEntry&&);
+    TxEntry& operator=(TxEntry&&);
+    ~TxEntry();
+
+    TxLookupFields fields;
+    base::Value value;
+  };
+
+  // chain, status, from
+  using StatusKey =
+      std::tuple<std::string, mojom::TransactionStatus, std::string>;
+  // chain, nonce
+  using NonceKey = std::pair<std::string, std::string>;
+
+  void AddEntry(const std::string& chain,
+                const std::string& id,
+                TxLookupFields fields,
+                base::Value value);
+  void RemoveFromIndices(const std::string& chain,
+                         const std::string& id,
+                         const TxLookupFields& fields);
+
+  void OnLoaded(absl::optional<std::vector<TxRecord>> records);
+  // Returns the txs stored in the kBraveWalletTransactions pref.
+  std::vector<TxRecord> ReadTxsFromPrefs() const;
+  void MigrateFromPrefs();
+  void OnMigratedFromPrefs(bool success);
+  void OnDatabaseWritten(bool success);
+  // Writes every tx to the pref, which is used instead of the database from
+  // then on.
+  void FallBackToPrefs();
+
+  raw_ptr<PrefService> prefs_ = nullptr;
+  base::SequenceBound<TxDatabase> database_;
+
+  // Keyed by chain, then tx id.
+  std::map<std::string, std::map<std::string, TxEntry>> txs_;
+  std::map<StatusKey, std::set<std::string>> ids_by_status_;
+  std::map<NonceKey, std::set<std::string>> ids_by_nonce_;
+
+  // Deletions made before the txs on disk were loaded, which the loaded txs
+  // must not bring back.
+  std::set<std::pair<std::string, std::string>> txs_deleted_before_load_;
+  std::set<std::string> chains_deleted_before_load_;
+  bool all_deleted_before_load_ = false;
+
+  enum class Storage {
+    kDatabase,
+    // The kBraveWalletTransactions pref, once the database has failed.
+    kPrefs,
+    // Nowhere, if the database can't be opened after the txs were moved to it.
+    kMemory,
+  };
+  Storage storage_ = Storage::kDatabase;
+
+  base::OneShotEvent loaded_;
+
+  base::WeakPtrFactory<TxStore> weak_factory_{this};
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORE_H_
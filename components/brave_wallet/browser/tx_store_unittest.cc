@@ -0,0 +1,370 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/tx_store.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "base/values.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
+#include "brave/components/brave_wallet/browser/eth_tx_meta.h"
+#include "brave/components/brave_wallet/browser/pref_names.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "components/prefs/scoped_user_pref_update.h"
+#include "components/sync_preferences/testing_pref_service_syncable.h"
+#include "sql/database.h"
+#include "sql/meta_table.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kChain[] = "ethereum.mainnet";
+constexpr char kFrom1[] = "0x3535353535353535353535353535353535353535";
+constexpr char kFrom2[] = "0x2f015c60e0be116b1f0cd534704db9c92118fb6a";
+
+base::Value TxValue(const std::string& id,
+                    mojom::TransactionStatus status,
+                    const std::string& from) {
+  EthTxMeta meta;
+  meta.set_id(id);
+  meta.set_status(status);
+  meta.set_from(from);
+  return meta.ToValue();
+}
+
+}  // namespace
+
+class TxStoreUnitTest : public testing::Test {
+ public:
+  TxStoreUnitTest() = default;
+
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    brave_wallet::RegisterProfilePrefs(prefs_.registry());
+  }
+
+  // Opens the store and waits for it to load.
+  std::unique_ptr<TxStore> OpenStore() {
+    auto store = std::make_unique<TxStore>(&prefs_, GetDatabasePath());
+    task_environment_.RunUntilIdle();
+    EXPECT_TRUE(store->is_loaded());
+    return store;
+  }
+
+  base::FilePath GetDatabasePath() const {
+    return temp_dir_.GetPath().AppendASCII("transactions");
+  }
+
+  // A database from a newer version can't be opened.
+  void SetDatabaseVersion(int version) {
+    sql::Database db;
+    sql::MetaTable meta_table;
+    ASSERT_TRUE(db.Open(GetDatabasePath()));
+    ASSERT_TRUE(meta_table.Init(&db, version, version));
+    meta_table.SetVersionNumber(version);
+    meta_table.SetCompatibleVersionNumber(version);
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  sync_preferences::TestingPrefServiceSyncable prefs_;
+};
+
+TEST_F(TxStoreUnitTest, GetTxIds) {
+  auto store = OpenStore();
+  EXPECT_TRUE(store->AddOrUpdateTx(
+      kChain, "003", TxValue("003", mojom::TransactionStatus::Submitted,
+                             kFrom1)));
+  EXPECT_TRUE(store->AddOrUpdateTx(
+      kChain, "001", TxValue("001", mojom::TransactionStatus::Submitted,
+                             kFrom2)));
+  EXPECT_TRUE(store->AddOrUpdateTx(
+      kChain, "002", TxValue("002", mojom::TransactionStatus::Confirmed,
+                             kFrom1)));
+  EXPECT_TRUE(store->AddOrUpdateTx(
+      "filecoin.mainnet", "004",
+      TxValue("004", mojom::TransactionStatus::Submitted, kFrom1)));
+
+  EXPECT_EQ(store->GetTxIds(kChain, absl::nullopt, absl::nullopt),
+            (std::vector<std::string>{"001", "002", "003"}));
+  EXPECT_EQ(store->GetTxIds(kChain, absl::nullopt, std::string(kFrom1)),
+            (std::vector<std::string>{"002", "003"}));
+  // Sorted across from addresses
+  EXPECT_EQ(
+      store->GetTxIds(kChain, mojom::TransactionStatus::Submitted,
+                      absl::nullopt),
+      (std::vector<std::string>{"001", "003"}));
+  EXPECT_EQ(store->GetTxIds(kChain, mojom::TransactionStatus::Submitted,
+                            std::string(kFrom1)),
+            (std::vector<std::string>{"003"}));
+
+  // Updating a tx moves it in the index
+  EXPECT_FALSE(store->AddOrUpdateTx(
+      kChain, "003", TxValue("003", mojom::TransactionStatus::Confirmed,
+                             kFrom1)));
+  EXPECT_EQ(store->GetTxIds(kChain, mojom::TransactionStatus::Submitted,
+                            absl::nullopt),
+            (std::vector<std::string>{"001"}));
+  EXPECT_EQ(store->GetTxIds(kChain, mojom::TransactionStatus::Confirmed,
+                            std::string(kFrom1)),
+            (std::vector<std::string>{"002", "003"}));
+  // Txs without a nonce are indexed under an empty one
+  EXPECT_EQ(store->GetTxIdsByNonce(kChain, ""),
+            (std::vector<std::string>{"001", "002", "003"}));
+
+  store->DeleteTxsForChain(kChain);
+  EXPECT_TRUE(store->GetTxIds(kChain, absl::nullopt, absl::nullopt).empty());
+  EXPECT_TRUE(store->GetTxIdsByNonce(kChain, "").empty());
+  EXPECT_TRUE(store->GetTx("filecoin.mainnet", "004"));
+}
+
+TEST_F(TxStoreUnitTest, PersistAcrossReopen) {
+  {
+    auto store = OpenStore();
+    store->AddOrUpdateTx(
+        kChain, "001",
+        TxValue("001", mojom::TransactionStatus::Submitted, kFrom1));
+    store->AddOrUpdateTx(
+        kChain, "002",
+        TxValue("002", mojom::TransactionStatus::Submitted, kFrom1));
+    store->AddOrUpdateTx(
+        kChain, "001",
+        TxValue("001", mojom::TransactionStatus::Confirmed, kFrom1));
+    store->AddOrUpdateTx(
+        "solana.mainnet", "003",
+        TxValue("003", mojom::TransactionStatus::Submitted, kFrom2));
+    store->DeleteTx(kChain, "002");
+  }
+  task_environment_.RunUntilIdle();
+
+  auto store = OpenStore();
+  const base::Value* value = store->GetTx(kChain, "001");
+  ASSERT_TRUE(value);
+  EXPECT_EQ(*value,
+            TxValue("001", mojom::TransactionStatus::Confirmed, kFrom1));
+  EXPECT_FALSE(store->GetTx(kChain, "002"));
+  EXPECT_TRUE(store->GetTx("solana.mainnet", "003"));
+  EXPECT_EQ(store->GetTxIds(kChain, mojom::TransactionStatus::Confirmed,
+                            std::string(kFrom1)),
+            (std::vector<std::string>{"001"}));
+
+  store->DeleteAllTxs();
+  store.reset();
+  task_environment_.RunUntilIdle();
+
+  store = OpenStore();
+  EXPECT_FALSE(store->GetTx(kChain, "001"));
+  EXPECT_FALSE(store->GetTx("solana.mainnet", "003"));
+}
+
+TEST_F(TxStoreUnitTest, ChangesBeforeLoad) {
+  {
+    auto store = OpenStore();
+    store->AddOrUpdateTx(
+        kChain, "001",
+        TxValue("001", mojom::TransactionStatus::Submitted, kFrom1));
+    store->AddOrUpdateTx(
+        kChain, "002",
+        TxValue("002", mojom::TransactionStatus::Submitted, kFrom1));
+    store->AddOrUpdateTx(
+        "solana.mainnet", "003",
+        TxValue("003", mojom::TransactionStatus::Submitted, kFrom1));
+  }
+  task_environment_.RunUntilIdle();
+
+  auto store = std::make_unique<TxStore>(&prefs_, GetDatabasePath());
+  bool ran = false;
+  store->RunWhenLoaded(base::BindLambdaForTesting([&]() { ran = true; }));
+  EXPECT_FALSE(store->is_loaded());
+  store->AddOrUpdateTx(
+      kChain, "001",
+      TxValue("001", mojom::TransactionStatus::Confirmed, kFrom1));
+  store->DeleteTx(kChain, "002");
+  store->DeleteTxsForChain("solana.mainnet");
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(store->is_loaded());
+  EXPECT_TRUE(ran);
+
+  // The loaded txs don't undo the earlier changes
+  const base::Value* value = store->GetTx(kChain, "001");
+  ASSERT_TRUE(value);
+  EXPECT_EQ(*value,
+            TxValue("001", mojom::TransactionStatus::Confirmed, kFrom1));
+  EXPECT_FALSE(store->GetTx(kChain, "002"));
+  EXPECT_FALSE(store->GetTx("solana.mainnet", "003"));
+}
+
+TEST_F(TxStoreUnitTest, MigrateFromPrefs) {
+  {
+    DictionaryPrefUpdate update(&prefs_, kBraveWalletTransactions);
+    update.Get()->SetPath(
+        "ethereum.mainnet.001",
+        TxValue("001", mojom::TransactionStatus::Submitted, kFrom1));
+    update.Get()->SetPath(
+        "solana.devnet.002",
+        TxValue("002", mojom::TransactionStatus::Confirmed, kFrom2));
+    // Can't be turned back into a TxMeta
+    update.Get()->SetPath("ethereum.mainnet.003", base::Value("bad"));
+  }
+
+  {
+    auto store = OpenStore();
+    EXPECT_TRUE(store->GetTx(kChain, "001"));
+    EXPECT_TRUE(store->GetTx("solana.devnet", "002"));
+    EXPECT_FALSE(store->GetTx(kChain, "003"));
+    EXPECT_EQ(store->GetTxIds("solana.devnet",
+                              mojom::TransactionStatus::Confirmed,
+                              std::string(kFrom2)),
+              (std::vector<std::string>{"002"}));
+    EXPECT_FALSE(prefs_.HasPrefPath(kBraveWalletTransactions));
+    EXPECT_TRUE(prefs_.GetBoolean(kBraveWalletTransactionsDBMigrated));
+  }
+  task_environment_.RunUntilIdle();
+
+  // Migrated only once, and kept in the database
+  {
+    DictionaryPrefUpdate update(&prefs_, kBraveWalletTransactions);
+    update.Get()->SetPath(
+        "ethereum.mainnet.004",
+        TxValue("004", mojom::TransactionStatus::Submitted, kFrom1));
+  }
+  auto store = OpenStore();
+  EXPECT_TRUE(store->GetTx(kChain, "001"));
+  EXPECT_TRUE(store->GetTx("solana.devnet", "002"));
+  EXPECT_FALSE(store->GetTx(kChain, "004"));
+}
+
+TEST_F(TxStoreUnitTest, FallBackToPrefs) {
+  {
+    DictionaryPrefUpdate update(&prefs_, kBraveWalletTransactions);
+    update.Get()->SetPath(
+        "ethereum.mainnet.001",
+        TxValue("001", mojom::TransactionStatus::Submitted, kFrom1));
+  }
+  SetDatabaseVersion(2);
+
+  {
+    auto store = OpenStore();
+    EXPECT_TRUE(store->GetTx(kChain, "001"));
+    store->AddOrUpdateTx(
+        kChain, "002",
+        TxValue("002", mojom::TransactionStatus::Submitted, kFrom2));
+    store->DeleteTx(kChain, "001");
+    task_environment_.RunUntilIdle();
+
+    const base::Value* transactions =
+        prefs_.GetDictionary(kBraveWalletTransactions);
+    EXPECT_FALSE(transactions->FindPath("ethereum.mainnet.001"));
+    EXPECT_TRUE(transactions->FindPath("ethereum.mainnet.002"));
+    EXPECT_FALSE(prefs_.GetBoolean(kBraveWalletTransactionsDBMigrated));
+  }
+  task_environment_.RunUntilIdle();
+
+  // Moved to the database once it can be opened
+  ASSERT_TRUE(base::DeleteFile(GetDatabasePath()));
+  {
+    auto store = OpenStore();
+    EXPECT_FALSE(store->GetTx(kChain, "001"));
+    EXPECT_TRUE(store->GetTx(kChain, "002"));
+    EXPECT_TRUE(prefs_.GetBoolean(kBraveWalletTransactionsDBMigrated));
+  }
+  task_environment_.RunUntilIdle();
+
+  auto store = OpenStore();
+  EXPECT_TRUE(store->GetTx(kChain, "002"));
+}
+
+TEST_F(TxStoreUnitTest, DatabaseFailsAfterMigration) {
+  {
+    DictionaryPrefUpdate update(&prefs_, kBraveWalletTransactions);
+    update.Get()->SetPath(
+        "ethereum.mainnet.001",
+        TxValue("001", mojom::TransactionStatus::Submitted, kFrom1));
+  }
+  {
+    auto store = OpenStore();
+    store->AddOrUpdateTx(
+        kChain, "002",
+        TxValue("002", mojom::TransactionStatus::Submitted, kFrom2));
+    task_environment_.RunUntilIdle();
+    EXPECT_TRUE(prefs_.GetBoolean(kBraveWalletTransactionsDBMigrated));
+  }
+  task_environment_.RunUntilIdle();
+
+  // The pref doesn't replace the database, and changes are kept in memory
+  SetDatabaseVersion(2);
+  {
+    auto store = OpenStore();
+    EXPECT_FALSE(store->GetTx(kChain, "001"));
+    store->AddOrUpdateTx(
+        kChain, "003",
+        TxValue("003", mojom::TransactionStatus::Submitted, kFrom1));
+    EXPECT_TRUE(store->GetTx(kChain, "003"));
+    store->DeleteTx(kChain, "002");
+    task_environment_.RunUntilIdle();
+
+    EXPECT_FALSE(prefs_.HasPrefPath(kBraveWalletTransactions));
+    EXPECT_TRUE(prefs_.GetBoolean(kBraveWalletTransactionsDBMigrated));
+  }
+  task_environment_.RunUntilIdle();
+
+  // The txs in the database are still there on the next start
+  SetDatabaseVersion(1);
+  auto store = OpenStore();
+  EXPECT_TRUE(store->GetTx(kChain, "001"));
+  EXPECT_TRUE(store->GetTx(kChain, "002"));
+  EXPECT_FALSE(store->GetTx(kChain, "003"));
+}
+
+TEST_F(TxStoreUnitTest, MergePrefsIntoDatabase) {
+  {
+    auto store = OpenStore();
+    store->AddOrUpdateTx(
+        kChain, "001",
+        TxValue("001", mojom::TransactionStatus::Submitted, kFrom1));
+    store->AddOrUpdateTx(
+        kChain, "002",
+        TxValue("002", mojom::TransactionStatus::Submitted, kFrom1));
+    task_environment_.RunUntilIdle();
+  }
+  task_environment_.RunUntilIdle();
+
+  // As left by a fall back to the pref in an earlier session
+  {
+    DictionaryPrefUpdate update(&prefs_, kBraveWalletTransactions);
+    update.Get()->SetPath(
+        "ethereum.mainnet.001",
+        TxValue("001", mojom::TransactionStatus::Confirmed, kFrom1));
+    update.Get()->SetPath(
+        "ethereum.mainnet.003",
+        TxValue("003", mojom::TransactionStatus::Submitted, kFrom2));
+  }
+  prefs_.SetBoolean(kBraveWalletTransactionsDBMigrated, false);
+
+  for (int i = 0; i < 2; ++i) {
+    auto store = OpenStore();
+    EXPECT_EQ(store->GetTxIds(kChain, mojom::TransactionStatus::Confirmed,
+                              absl::nullopt),
+              (std::vector<std::string>{"001"}));
+    EXPECT_TRUE(store->GetTx(kChain, "002"));
+    EXPECT_TRUE(store->GetTx(kChain, "003"));
+    EXPECT_FALSE(prefs_.HasPrefPath(kBraveWalletTransactions));
+    EXPECT_TRUE(prefs_.GetBoolean(kBraveWalletTransactionsDBMigrated));
+    store.reset();
+    task_environment_.RunUntilIdle();
+  }
+}
+
+}  // namespace brave_wallet
@@ -27,5 +27,24 @@ const base::Feature kBraveWalletSolanaFeature{
 const base::Feature kBraveWalletSolanaProviderFeature{
     "BraveWalletSolanaProvider", base::FEATURE_DISABLED_BY_DEFAULT};
 
+// Shares one network request between identical in-flight JSON-RPC requests,
+// and sends requests made close together to the same network as a single
+// batch request.
+const base::Feature kBraveWalletJsonRpcBatchingFeature{
+    "BraveWalletJsonRpcBatching", base::FEATURE_DISABLED_BY_DEFAULT};
+const base::FeatureParam<int> kBraveWalletJsonRpcBatchWindowMs{
+    &kBraveWalletJsonRpcBatchingFeature, "batch_window_ms", 10};
+
+// Answers repeated read-only JSON-RPC calls from a cache until the next block.
+const base::Feature kBraveWalletJsonRpcResponseCacheFeature{
+    "BraveWalletJsonRpcResponseCache", base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Checks several derived accounts at once when discovering accounts of a
+// restored wallet.
+const base::Feature kBraveWalletParallelAccountDiscoveryFeature{
+    "BraveWalletParallelAccountDiscovery", base::FEATURE_DISABLED_BY_DEFAULT};
+const base::FeatureParam<int> kBraveWalletAccountDiscoveryRequestsInFlight{
+    &kBraveWalletParallelAccountDiscoveryFeature, "requests_in_flight", 5};
+
 }  // namespace features
 }  // namespace brave_wallet
@@ -6,6 +6,8 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_COMMON_FEATURES_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_COMMON_FEATURES_H_
 
+#include "base/metrics/field_trial_params.h"
+
 namespace base {
 struct Feature;
 }  // namespace base
@@ -17,6 +19,12 @@ extern const base::Feature kNativeBraveWalletFeature;
 extern const base::Feature kBraveWalletFilecoinFeature;
 extern const base::Feature kBraveWalletSolanaFeature;
 extern const base::Feature kBraveWalletSolanaProviderFeature;
+extern const base::Feature kBraveWalletJsonRpcBatchingFeature;
+extern const base::FeatureParam<int> kBraveWalletJsonRpcBatchWindowMs;
+extern const base::Feature kBraveWalletJsonRpcResponseCacheFeature;
+extern const base::Feature kBraveWalletParallelAccountDiscoveryFeature;
+extern const base::FeatureParam<int>
+    kBraveWalletAccountDiscoveryRequestsInFlight;
 
 }  // namespace features
 }  // namespace brave_wallet
@@ -5,13 +5,20 @@
 
 #include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
 
+#include <algorithm>
+#include <map>
 #include <memory>
+#include <string>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "base/bind.h"
+#include "base/containers/flat_set.h"
 #include "base/no_destructor.h"
 #include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
 #include "base/task/post_task.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/pref_names.h"
@@ -102,8 +109,22 @@ class BraveShieldsRuleIterator : public RuleIterator {
   const std::vector<Rule>::const_iterator rules_end_;
 };
 
+// Shield rules, in precedence order, grouped by the host of their primary
+// pattern.
+using ShieldRulesByHost = std::map<std::string, std::vector<size_t>>;
+
+ShieldRulesByHost GetShieldRulesByHost(const std::vector<Rule>& shield_rules) {
+  ShieldRulesByHost shield_rules_by_host;
+  for (size_t i = 0; i < shield_rules.size(); ++i) {
+    shield_rules_by_host[shield_rules[i].primary_pattern.GetHost()].push_back(
+        i);
+  }
+  return shield_rules_by_host;
+}
+
 bool IsActive(const Rule& cookie_rule,
-              const std::vector<Rule>& shield_rules) {
+              const std::vector<Rule>& shield_rules,
+              const ShieldRulesByHost& shield_rules_by_host) {
   // don't include default rules in the iterator
   if (cookie_rule.primary_pattern == ContentSettingsPattern::Wildcard() &&
       (cookie_rule.secondary_pattern == ContentSettingsPattern::Wildcard() ||
@@ -111,8 +132,27 @@ bool IsActive(const Rule& cookie_rule,
     return false;
   }
 
+  // A shield rule can only be identical to, or a superset of, the cookie
+  // rule's primary pattern if its host is the same host, a parent domain of
+  // it or a wildcard. Only those rules are compared, in precedence order.
+  std::vector<size_t> candidates;
+  base::StringPiece host = cookie_rule.primary_pattern.GetHost();
+  while (true) {
+    auto it = shield_rules_by_host.find(std::string(host));
+    if (it != shield_rules_by_host.end()) {
+      candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+    }
+    if (host.empty())
+      break;
+    const size_t dot = host.find('.');
+    host = dot == base::StringPiece::npos ? base::StringPiece()
+                                          : host.substr(dot + 1);
+  }
+  std::sort(candidates.begin(), candidates.end());
+
   bool default_value = true;
-  for (const auto& shield_rule : shield_rules) {
+  for (const size_t index : candidates) {
+    const Rule& shield_rule = shield_rules[index];
     auto primary_compare =
         shield_rule.primary_pattern.Compare(cookie_rule.primary_pattern);
     // TODO(bridiver) - verify that SUCCESSOR is correct and not PREDECESSOR
@@ -126,6 +166,57 @@ bool IsActive(const Rule& cookie_rule,
   return default_value;
 }
 
+// Returns the rules in |new_rules| that are missing from or differ from
+// |old_rules|, followed by the rules of |old_rules| whose patterns are no
+// longer in |new_rules|. Removed rules have no value.
+std::vector<Rule> GetCookieRuleUpdates(const std::vector<Rule>& old_rules,
+                                       const std::vector<Rule>& new_rules) {
+  using PatternPair = std::pair<ContentSettingsPattern, ContentSettingsPattern>;
+  using PatternPairSetting = std::tuple<ContentSettingsPattern,
+                                        ContentSettingsPattern, ContentSetting>;
+
+  std::vector<PatternPairSetting> old_settings;
+  old_settings.reserve(old_rules.size());
+  for (const auto& old_rule : old_rules) {
+    old_settings.emplace_back(old_rule.primary_pattern,
+                              old_rule.secondary_pattern,
+                              ValueToContentSetting(old_rule.value));
+  }
+  const base::flat_set<PatternPairSetting> old_settings_set(
+      std::move(old_settings));
+
+  std::vector<PatternPair> new_patterns;
+  new_patterns.reserve(new_rules.size());
+  for (const auto& new_rule : new_rules) {
+    new_patterns.emplace_back(new_rule.primary_pattern,
+                              new_rule.secondary_pattern);
+  }
+  const base::flat_set<PatternPair> new_patterns_set(std::move(new_patterns));
+
+  std::vector<Rule> updates;
+  for (const auto& new_rule : new_rules) {
+    // we want an exact match here because any change to the rule is an update
+    if (!old_settings_set.contains({new_rule.primary_pattern,
+                                    new_rule.secondary_pattern,
+                                    ValueToContentSetting(new_rule.value)})) {
+      updates.emplace_back(CloneRule(new_rule));
+    }
+  }
+
+  for (const auto& old_rule : old_rules) {
+    // we only care about the patterns here because we're looking for deleted
+    // rules, not changed rules
+    if (!new_patterns_set.contains(
+            {old_rule.primary_pattern, old_rule.secondary_pattern})) {
+      updates.emplace_back(old_rule.primary_pattern,
+                           old_rule.secondary_pattern, base::Value(),
+                           old_rule.expiration, old_rule.session_model);
+    }
+  }
+
+  return updates;
+}
+
 }  // namespace
 
 // static
@@ -516,12 +607,14 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
 
   // add brave cookies after checking shield status
   {
+    const ShieldRulesByHost shield_rules_by_host =
+        GetShieldRulesByHost(shield_rules);
     auto brave_cookies_iterator = PrefProvider::GetRuleIterator(
         ContentSettingsType::BRAVE_COOKIES, incognito);
     // Matching cookie rules against shield rules.
     while (brave_cookies_iterator && brave_cookies_iterator->HasNext()) {
       auto rule = brave_cookies_iterator->Next();
-      if (IsActive(rule, shield_rules)) {
+      if (IsActive(rule, shield_rules, shield_rules_by_host)) {
         rules.emplace_back(CloneRule(rule, true));
         brave_cookie_rules_[incognito].emplace_back(CloneRule(rule, true));
       }
@@ -547,43 +640,6 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
     }
   }
 
-  // get the list of changes
-  std::vector<Rule> brave_cookie_updates;
-  for (const auto& new_rule : brave_cookie_rules_[incognito]) {
-    auto match = std::find_if(
-        old_rules.begin(),
-        old_rules.end(),
-        [&new_rule](const auto& old_rule) {
-          // we want an exact match here because any change to the rule
-          // is an update
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern &&
-                 ValueToContentSetting(new_rule.value) ==
-                     ValueToContentSetting(old_rule.value);
-        });
-    if (match == old_rules.end()) {
-      brave_cookie_updates.emplace_back(CloneRule(new_rule));
-    }
-  }
-
-  // find any removed rules
-  for (const auto& old_rule : old_rules) {
-    auto match = std::find_if(
-        brave_cookie_rules_[incognito].begin(),
-        brave_cookie_rules_[incognito].end(),
-        [&old_rule](const auto& new_rule) {
-          // we only care about the patterns here because we're looking
-          // for deleted rules, not changed rules
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern;
-        });
-    if (match == brave_cookie_rules_[incognito].end()) {
-      brave_cookie_updates.emplace_back(
-          Rule(old_rule.primary_pattern, old_rule.secondary_pattern,
-               base::Value(), old_rule.expiration, old_rule.session_model));
-    }
-  }
-
   {
     base::AutoLock auto_lock(lock_);
     cookie_rules_[incognito] = std::move(rules);
@@ -592,6 +648,11 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   // Notify brave cookie changes as ContentSettingsType::COOKIES
   if (initialized_ && (content_type == ContentSettingsType::BRAVE_COOKIES ||
                        content_type == ContentSettingsType::BRAVE_SHIELDS)) {
+    std::vector<Rule> brave_cookie_updates =
+        GetCookieRuleUpdates(old_rules, brave_cookie_rules_[incognito]);
+    if (brave_cookie_updates.empty())
+      return;
+
     // PostTask here to avoid content settings autolock DCHECK
     base::PostTask(
         FROM_HERE,
@@ -525,4 +525,46 @@ TEST_F(BravePrefProviderTest, TestShieldsSettingsMigrationFromUnknownSettings) {
   provider.ShutdownOnUIThread();
 }
 
+TEST_F(BravePrefProviderTest, ShieldsDownOverridesCookieRules) {
+  BravePrefProvider provider(
+      testing_profile()->GetPrefs(), false /* incognito */,
+      true /* store_last_modified */, false /* restore_session */);
+
+  const GURL url("https://brave.com");
+  const GURL site_url("https://sub.example.com");
+  auto get_cookie_setting = [&]() {
+    return TestUtils::GetContentSetting(&provider, url, site_url,
+                                        ContentSettingsType::COOKIES, false);
+  };
+
+  provider.SetWebsiteSetting(
+      ContentSettingsPattern::FromString("sub.example.com"),
+      ContentSettingsPattern::Wildcard(), ContentSettingsType::BRAVE_COOKIES,
+      ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK, get_cookie_setting());
+
+  // Shields down for another site doesn't change the cookie rule.
+  provider.SetWebsiteSetting(
+      ContentSettingsPattern::FromString("[*.]example.org"),
+      ContentSettingsPattern::Wildcard(), ContentSettingsType::BRAVE_SHIELDS,
+      ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK, get_cookie_setting());
+
+  // Shields down for a parent domain turns the cookie rule off.
+  const auto parent_pattern =
+      ContentSettingsPattern::FromString("[*.]example.com");
+  provider.SetWebsiteSetting(
+      parent_pattern, ContentSettingsPattern::Wildcard(),
+      ContentSettingsType::BRAVE_SHIELDS,
+      ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+  EXPECT_EQ(CONTENT_SETTING_ALLOW, get_cookie_setting());
+
+  provider.SetWebsiteSetting(parent_pattern, ContentSettingsPattern::Wildcard(),
+                             ContentSettingsType::BRAVE_SHIELDS, base::Value(),
+                             {});
+  EXPECT_EQ(CONTENT_SETTING_BLOCK, get_cookie_setting());
+
+  provider.ShutdownOnUIThread();
+}
+
 }  //  namespace content_settings
@@ -10,6 +10,7 @@
 #include "base/json/json_reader.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
+#include "brave/components/brave_shields/browser/ad_block_service_helper.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "components/content_settings/core/browser/host_content_settings_map.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -71,9 +72,8 @@ void CosmeticFiltersResources::UrlCosmeticResources(
     const std::string& url,
     UrlCosmeticResourcesCallback callback) {
   DCHECK(ad_block_service_->GetTaskRunner()->RunsTasksInCurrentSequence());
-  auto resources = ad_block_service_->UrlCosmeticResources(url);
-  std::move(callback).Run(resources ? std::move(resources.value())
-                                    : base::Value());
+  std::move(callback).Run(brave_shields::CosmeticResourcesToValue(
+      ad_block_service_->UrlCosmeticResources(url)));
 }
 
 }  // namespace cosmetic_filters
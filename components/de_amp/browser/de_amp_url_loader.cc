@@ -71,31 +71,41 @@ void DeAmpURLLoader::OnBodyReadable(MojoResult) {
     return;
   }
 
-  if (!MaybeRedirectToCanonicalLink()) {
-    CompleteLoading(std::move(buffered_body_));
+  // Only new bytes are scanned, so keep reading until the scanner has
+  // decided whether this is an AMP page.
+  switch (amp_head_scanner_.Scan(buffered_body_)) {
+    case AmpHeadScanner::Result::kNeedMoreData:
+      body_consumer_watcher_.ArmOrNotify();
+      return;
+    case AmpHeadScanner::Result::kFoundCanonicalUrl:
+      if (MaybeRedirectToCanonicalLink(amp_head_scanner_.canonical_url())) {
+        return;
+      }
+      break;
+    case AmpHeadScanner::Result::kNotAmp:
+      // Did not find AMP page and/or canonical link, load original
+      break;
   }
 
+  CompleteLoading(std::move(buffered_body_));
   body_consumer_watcher_.ArmOrNotify();
 }
 
-bool DeAmpURLLoader::MaybeRedirectToCanonicalLink() {
-  std::string canonical_link;
-
-  if (de_amp_throttle_ &&
-      MaybeFindCanonicalAmpUrl(buffered_body_, &canonical_link)) {
-    const GURL canonical_url(canonical_link);
-    if (!VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
-      VLOG(2) << __func__ << " canonical link check failed " << canonical_url;
-      return false;
-    }
-    VLOG(2) << __func__ << " de-amping and loading " << canonical_url;
-    Abort();
-    de_amp_throttle_->Redirect(canonical_url, response_url_);
-    return true;
-  } else {
-    // Did not find AMP page and/or canonical link, load original
+bool DeAmpURLLoader::MaybeRedirectToCanonicalLink(
+    const std::string& canonical_link) {
+  if (!de_amp_throttle_) {
+    return false;
+  }
+
+  const GURL canonical_url(canonical_link);
+  if (!VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
+    VLOG(2) << __func__ << " canonical link check failed " << canonical_url;
     return false;
   }
+  VLOG(2) << __func__ << " de-amping and loading " << canonical_url;
+  Abort();
+  de_amp_throttle_->Redirect(canonical_url, response_url_);
+  return true;
 }
 
 void DeAmpURLLoader::OnBodyWritable(MojoResult r) {
@@ -5,8 +5,10 @@
 
 #include "brave/components/de_amp/browser/de_amp_util.h"
 
+#include "base/check_op.h"
 #include "base/feature_list.h"
 #include "base/no_destructor.h"
+#include "base/strings/string_util.h"
 #include "brave/components/de_amp/common/features.h"
 #include "brave/components/de_amp/common/pref_names.h"
 #include "components/prefs/pref_service.h"
@@ -28,6 +30,63 @@ constexpr char kDetectAmpPattern[] =
 constexpr char kFindCanonicalLinkTagPattern[] =
     "(<\\s*?link\\s[^>]*?rel=(?:\"|')canonical(?:\"|')(?:\\s[^>]*?>|>|/>))";
 constexpr char kFindCanonicalHrefInTagPattern[] = "href=(?:\"|')(.*?)(?:\"|')";
+
+// Documents whose head is larger than this are loaded without de-AMPing
+constexpr size_t kMaxHeadScanSize = 512 * 1024;
+
+RE2::Options GetRegexOptions() {
+  RE2::Options opt;
+  opt.set_case_sensitive(false);
+  opt.set_dot_nl(true);
+  return opt;
+}
+
+const re2::RE2& GetHtmlTagRegex() {
+  static const base::NoDestructor<re2::RE2> regex(kGetHtmlTagPattern,
+                                                  GetRegexOptions());
+  return *regex;
+}
+
+const re2::RE2& GetDetectAmpRegex() {
+  static const base::NoDestructor<re2::RE2> regex(kDetectAmpPattern,
+                                                  GetRegexOptions());
+  return *regex;
+}
+
+const re2::RE2& GetFindCanonicalLinkTagRegex() {
+  static const base::NoDestructor<re2::RE2> regex(kFindCanonicalLinkTagPattern,
+                                                  GetRegexOptions());
+  return *regex;
+}
+
+const re2::RE2& GetFindCanonicalHrefInTagRegex() {
+  static const base::NoDestructor<re2::RE2> regex(
+      kFindCanonicalHrefInTagPattern, GetRegexOptions());
+  return *regex;
+}
+
+// Returns the lower case name of |tag|, including the slash of end tags.
+std::string GetTagName(base::StringPiece tag) {
+  DCHECK(!tag.empty() && tag.front() == '<');
+  size_t start = 1;
+  while (start < tag.size() && base::IsAsciiWhitespace(tag[start])) {
+    start++;
+  }
+  size_t end = start;
+  if (end < tag.size() && tag[end] == '/') {
+    end++;
+  }
+  while (end < tag.size() && !base::IsAsciiWhitespace(tag[end]) &&
+         tag[end] != '>' && tag[end] != '/') {
+    end++;
+  }
+  return base::ToLowerASCII(tag.substr(start, end - start));
+}
+
+re2::StringPiece ToRE2StringPiece(base::StringPiece value) {
+  return re2::StringPiece(value.data(), value.size());
+}
+
 }  // namespace
 
 bool IsDeAmpEnabled(PrefService* prefs) {
@@ -47,37 +106,98 @@ bool VerifyCanonicalAmpUrl(const GURL& canonical_link,
 // canonical link param is populated if found
 bool MaybeFindCanonicalAmpUrl(const std::string& body,
                               std::string* canonical_url) {
-  RE2::Options opt;
-  opt.set_case_sensitive(false);
-  opt.set_dot_nl(true);
   // The order of running these regexes is important:
   // we first get the relevant HTML tag and then find the info.
-  static const base::NoDestructor<re2::RE2> kGetHtmlTagRegex(kGetHtmlTagPattern,
-                                                             opt);
-  static const base::NoDestructor<re2::RE2> kDetectAmpRegex(kDetectAmpPattern,
-                                                            opt);
-  static const base::NoDestructor<re2::RE2> kFindCanonicalLinkTagRegex(
-      kFindCanonicalLinkTagPattern, opt);
-  static const base::NoDestructor<re2::RE2> kFindCanonicalHrefInTagRegex(
-      kFindCanonicalHrefInTagPattern, opt);
-
   std::string html_tag;
-  if (!RE2::PartialMatch(body, *kGetHtmlTagRegex, &html_tag)) {
+  if (!RE2::PartialMatch(body, GetHtmlTagRegex(), &html_tag)) {
     // Early exit if we can't find HTML tag - malformed document (or error)
     return false;
   }
-  if (!RE2::PartialMatch(html_tag, *kDetectAmpRegex)) {
+  if (!RE2::PartialMatch(html_tag, GetDetectAmpRegex())) {
     // Not AMP
     return false;
   }
   std::string link_tag;
-  if (!RE2::PartialMatch(body, *kFindCanonicalLinkTagRegex, &link_tag)) {
+  if (!RE2::PartialMatch(body, GetFindCanonicalLinkTagRegex(), &link_tag)) {
     // Can't find link tag, exit
     return false;
   }
 
-  return RE2::PartialMatch(link_tag, *kFindCanonicalHrefInTagRegex,
+  return RE2::PartialMatch(link_tag, GetFindCanonicalHrefInTagRegex(),
                            canonical_url);
 }
 
+AmpHeadScanner::AmpHeadScanner() = default;
+
+AmpHeadScanner::~AmpHeadScanner() = default;
+
+AmpHeadScanner::Result AmpHeadScanner::Scan(base::StringPiece body) {
+  DCHECK_LE(offset_, body.size());
+
+  while (offset_ < body.size()) {
+    const size_t tag_start = body.find('<', offset_);
+    if (tag_start == base::StringPiece::npos) {
+      offset_ = body.size();
+      break;
+    }
+
+    const size_t tag_end = body.find('>', tag_start);
+    if (tag_end == base::StringPiece::npos) {
+      // Wait for the rest of the tag
+      offset_ = tag_start;
+      break;
+    }
+
+    offset_ = tag_end + 1;
+    const Result result =
+        ScanTag(body.substr(tag_start, tag_end - tag_start + 1));
+    if (result != Result::kNeedMoreData) {
+      return result;
+    }
+  }
+
+  if (body.size() >= kMaxHeadScanSize) {
+    return Result::kNotAmp;
+  }
+
+  return Result::kNeedMoreData;
+}
+
+AmpHeadScanner::Result AmpHeadScanner::ScanTag(base::StringPiece tag) {
+  const std::string name = GetTagName(tag);
+
+  if (name == "body" || name == "/head") {
+    return Result::kNotAmp;
+  }
+
+  if (!is_amp_) {
+    if (name == "head") {
+      // No <html> tag - malformed document (or error)
+      return Result::kNotAmp;
+    }
+    if (name != "html") {
+      return Result::kNeedMoreData;
+    }
+    if (!RE2::PartialMatch(ToRE2StringPiece(tag), GetHtmlTagRegex()) ||
+        !RE2::PartialMatch(ToRE2StringPiece(tag), GetDetectAmpRegex())) {
+      return Result::kNotAmp;
+    }
+    is_amp_ = true;
+    return Result::kNeedMoreData;
+  }
+
+  if (name != "link" ||
+      !RE2::PartialMatch(ToRE2StringPiece(tag),
+                         GetFindCanonicalLinkTagRegex())) {
+    return Result::kNeedMoreData;
+  }
+
+  if (!RE2::PartialMatch(ToRE2StringPiece(tag),
+                         GetFindCanonicalHrefInTagRegex(), &canonical_url_)) {
+    return Result::kNotAmp;
+  }
+
+  return Result::kFoundCanonicalUrl;
+}
+
 }  // namespace de_amp
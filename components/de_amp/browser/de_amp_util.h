@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "base/strings/string_piece.h"
 #include "components/prefs/pref_service.h"
 #include "url/gurl.h"
 
@@ -16,6 +17,34 @@ bool IsDeAmpEnabled(PrefService* prefs);
 bool MaybeFindCanonicalAmpUrl(const std::string& body,
                               std::string* canonical_url);
 bool VerifyCanonicalAmpUrl(const GURL& canonical_url, const GURL& original_url);
+
+// Looks for the canonical link of an AMP page while the document is still
+// arriving. Each tag is only looked at once, and scanning stops at the first
+// <body> or </head> tag, after a non-AMP <html> tag, or once the document
+// grows past a fixed size.
+class AmpHeadScanner {
+ public:
+  enum class Result { kNeedMoreData, kNotAmp, kFoundCanonicalUrl };
+
+  AmpHeadScanner();
+  AmpHeadScanner(const AmpHeadScanner&) = delete;
+  AmpHeadScanner& operator=(const AmpHeadScanner&) = delete;
+  ~AmpHeadScanner();
+
+  // |body| is everything received so far, so it must begin with the |body|
+  // passed to the previous call.
+  Result Scan(base::StringPiece body);
+
+  // Only valid after |Scan| returns kFoundCanonicalUrl.
+  const std::string& canonical_url() const { return canonical_url_; }
+
+ private:
+  Result ScanTag(base::StringPiece tag);
+
+  size_t offset_ = 0;
+  bool is_amp_ = false;
+  std::string canonical_url_;
+};
 }  // namespace de_amp
 
 #endif  // BRAVE_COMPONENTS_DE_AMP_BROWSER_DE_AMP_UTIL_H_
@@ -18,6 +18,22 @@ void CheckFindCanonicalLinkResult(const std::string& expected_link,
   if (expected_detect_amp) {
     EXPECT_EQ(expected_link, canonical_url);
   }
+
+  // The scanner must come to the same result when the body arrives one byte
+  // at a time.
+  AmpHeadScanner scanner;
+  AmpHeadScanner::Result result = AmpHeadScanner::Result::kNeedMoreData;
+  for (size_t size = 1; size <= body.size(); size++) {
+    result = scanner.Scan(base::StringPiece(body.data(), size));
+    if (result != AmpHeadScanner::Result::kNeedMoreData) {
+      break;
+    }
+  }
+  EXPECT_EQ(expected_detect_amp,
+            result == AmpHeadScanner::Result::kFoundCanonicalUrl);
+  if (expected_detect_amp) {
+    EXPECT_EQ(expected_link, scanner.canonical_url());
+  }
 }
 void CheckCheckCanonicalLinkResult(const std::string& canonical_link,
                                    const std::string& original,
@@ -164,6 +180,33 @@ TEST(DeAmpUtilUnitTest, SingleQuotes) {
   CheckFindCanonicalLinkResult("https://abc.com", body, true);
 }
 
+TEST(DeAmpUtilUnitTest, ScannerStopsAtNonAmpHtmlTag) {
+  AmpHeadScanner scanner;
+  EXPECT_EQ(AmpHeadScanner::Result::kNeedMoreData,
+            scanner.Scan("<!DOCTYPE html>\n<ht"));
+  EXPECT_EQ(AmpHeadScanner::Result::kNotAmp,
+            scanner.Scan("<!DOCTYPE html>\n<html lang=\"en\">"));
+}
+
+TEST(DeAmpUtilUnitTest, ScannerFindsCanonicalLinkAfterLargeHead) {
+  const std::string body = "<html amp><head><style amp-custom>" +
+                           std::string(100000, 'x') +
+                           "</style><link rel=\"canonical\" "
+                           "href=\"https://abc.com\"/></head>";
+  AmpHeadScanner scanner;
+  EXPECT_EQ(AmpHeadScanner::Result::kNeedMoreData,
+            scanner.Scan(base::StringPiece(body.data(), 50000)));
+  EXPECT_EQ(AmpHeadScanner::Result::kFoundCanonicalUrl, scanner.Scan(body));
+  EXPECT_EQ("https://abc.com", scanner.canonical_url());
+}
+
+TEST(DeAmpUtilUnitTest, ScannerGivesUpOnOversizedHead) {
+  const std::string body =
+      "<html amp><head><style amp-custom>" + std::string(1024 * 1024, 'x');
+  AmpHeadScanner scanner;
+  EXPECT_EQ(AmpHeadScanner::Result::kNotAmp, scanner.Scan(body));
+}
+
 TEST(DeAmpUtilUnitTest, CanonicalLinkMissingScheme) {
   CheckCheckCanonicalLinkResult("xyz.com", "https://amp.xyz.com", false);
 }
@@ -5,6 +5,8 @@
 
 #include "brave/components/debounce/browser/debounce_component_installer.h"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <utility>
 
@@ -55,12 +57,16 @@ void DebounceComponentInstaller::OnDATFileDataReady(
   }
   rules_.clear();
   host_cache_.clear();
+  rule_indices_by_etldp1_.clear();
+  site_agnostic_rule_indices_.clear();
   std::vector<std::string> hosts;
   base::JSONValueConverter<DebounceRule> converter;
   for (base::Value& it : root->GetList()) {
     std::unique_ptr<DebounceRule> rule = std::make_unique<DebounceRule>();
     if (!converter.Convert(it, rule.get()))
       continue;
+    const size_t rule_index = rules_.size();
+    bool is_site_agnostic = false;
     for (const URLPattern& pattern : rule->include_pattern_set()) {
       if (!pattern.host().empty()) {
         std::string etldp1 =
@@ -68,16 +74,50 @@ void DebounceComponentInstaller::OnDATFileDataReady(
                 pattern.host(),
                 net::registry_controlled_domains::PrivateRegistryFilter::
                     INCLUDE_PRIVATE_REGISTRIES);
+        // Any URL this pattern matches shares its eTLD+1, unless the pattern
+        // is for an IP address or a public suffix.
+        if (etldp1.empty()) {
+          is_site_agnostic = true;
+        } else {
+          std::vector<size_t>& indices = rule_indices_by_etldp1_[etldp1];
+          if (indices.empty() || indices.back() != rule_index)
+            indices.push_back(rule_index);
+        }
         hosts.push_back(std::move(etldp1));
+      } else {
+        is_site_agnostic = true;
       }
     }
+    if (is_site_agnostic)
+      site_agnostic_rule_indices_.push_back(rule_index);
     rules_.push_back(std::move(rule));
   }
   host_cache_ = std::move(hosts);
+  // Fold the rules which apply everywhere into each site's list, so that a
+  // lookup returns every candidate in the order rules are applied.
+  if (!site_agnostic_rule_indices_.empty()) {
+    for (auto& entry : rule_indices_by_etldp1_) {
+      std::vector<size_t> indices;
+      indices.reserve(entry.second.size() + site_agnostic_rule_indices_.size());
+      std::set_union(entry.second.begin(), entry.second.end(),
+                     site_agnostic_rule_indices_.begin(),
+                     site_agnostic_rule_indices_.end(),
+                     std::back_inserter(indices));
+      entry.second = std::move(indices);
+    }
+  }
   for (Observer& observer : observers_)
     observer.OnRulesReady(this);
 }
 
+const std::vector<size_t>& DebounceComponentInstaller::GetRuleIndices(
+    const std::string& etldp1) const {
+  auto it = rule_indices_by_etldp1_.find(etldp1);
+  if (it == rule_indices_by_etldp1_.end())
+    return site_agnostic_rule_indices_;
+  return it->second;
+}
+
 void DebounceComponentInstaller::OnComponentReady(
     const std::string& component_id,
     const base::FilePath& install_dir,
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
 #include "base/json/json_value_converter.h"
@@ -25,6 +26,7 @@
 namespace debounce {
 
 class DebounceBrowserTest;
+class DebounceComponentInstallerTest;
 
 extern const char kDebounceConfigFile[];
 extern const char kDebounceConfigFileVersion[];
@@ -45,6 +47,10 @@ class DebounceComponentInstaller
     return rules_;
   }
   const base::flat_set<std::string>& host_cache() const { return host_cache_; }
+  // Returns the positions in rules(), in ascending order, of the rules which
+  // could apply to a URL whose eTLD+1 is |etldp1|. Rules with an include
+  // pattern that isn't tied to a single site are part of every result.
+  const std::vector<size_t>& GetRuleIndices(const std::string& etldp1) const;
 
   // implementation of brave_component_updater::LocalDataFilesObserver
   void OnComponentReady(const std::string& component_id,
@@ -64,6 +70,7 @@ class DebounceComponentInstaller
 
  private:
   friend class DebounceBrowserTest;
+  friend class DebounceComponentInstallerTest;
 
   void OnDATFileDataReady(const std::string& contents);
   void LoadOnTaskRunner();
@@ -72,6 +79,8 @@ class DebounceComponentInstaller
   base::ObserverList<Observer> observers_;
   std::vector<std::unique_ptr<DebounceRule>> rules_;
   base::flat_set<std::string> host_cache_;
+  base::flat_map<std::string, std::vector<size_t>> rule_indices_by_etldp1_;
+  std::vector<size_t> site_agnostic_rule_indices_;
   base::FilePath resource_dir_;
 
   base::WeakPtrFactory<DebounceComponentInstaller> weak_factory_{this};
@@ -5,6 +5,7 @@
 
 #include "brave/components/debounce/browser/debounce_service.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -18,6 +19,16 @@
 
 namespace debounce {
 
+namespace {
+
+std::string GetETLDPlusOne(const GURL& url) {
+  return net::registry_controlled_domains::GetDomainAndRegistry(
+      url, net::registry_controlled_domains::PrivateRegistryFilter::
+               INCLUDE_PRIVATE_REGISTRIES);
+}
+
+}  // namespace
+
 DebounceService::DebounceService(
     DebounceComponentInstaller* component_installer)
     : component_installer_(component_installer) {}
@@ -30,11 +41,7 @@ bool DebounceService::Debounce(const GURL& original_url,
   // applied.
   const base::flat_set<std::string>& host_cache =
       component_installer_->host_cache();
-  const std::string etldp1 =
-      net::registry_controlled_domains::GetDomainAndRegistry(
-          original_url, net::registry_controlled_domains::
-                            PrivateRegistryFilter::INCLUDE_PRIVATE_REGISTRIES);
-  if (!base::Contains(host_cache, etldp1))
+  if (!base::Contains(host_cache, GetETLDPlusOne(original_url)))
     return false;
 
   bool changed = false;
@@ -46,11 +53,25 @@ bool DebounceService::Debounce(const GURL& original_url,
   // one rule applies, the URL is changed to the debounced URL and we continue
   // to apply the rest of the rules to the new URL. Previously checked rules are
   // not reapplied; i.e. we never restart the loop.
-  for (const std::unique_ptr<DebounceRule>& rule : rules) {
-    if (rule->Apply(current_url, final_url)) {
-      if (current_url != *final_url) {
+  //
+  // Only rules which could match the current URL's site are checked; the
+  // candidates are looked up again whenever a rule changes the URL.
+  size_t next_rule_index = 0;
+  bool url_changed = true;
+  while (url_changed) {
+    url_changed = false;
+    const std::vector<size_t>& rule_indices =
+        component_installer_->GetRuleIndices(GetETLDPlusOne(current_url));
+    for (auto it = std::lower_bound(rule_indices.begin(), rule_indices.end(),
+                                    next_rule_index);
+         it != rule_indices.end(); ++it) {
+      if (rules[*it]->Apply(current_url, final_url) &&
+          current_url != *final_url) {
         changed = true;
+        url_changed = true;
         current_url = *final_url;
+        next_rule_index = *it + 1;
+        break;
       }
     }
   }
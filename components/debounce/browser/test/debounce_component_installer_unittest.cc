@@ -0,0 +1,159 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/debounce/browser/debounce_component_installer.h"
+
+#include <string>
+#include <vector>
+
+#include "base/containers/contains.h"
+#include "brave/components/brave_component_updater/browser/local_data_files_service.h"
+#include "brave/components/debounce/browser/debounce_service.h"
+#include "net/base/url_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace debounce {
+
+class DebounceComponentInstallerTest : public testing::Test {
+ public:
+  DebounceComponentInstallerTest()
+      : local_data_files_service_(nullptr),
+        component_installer_(&local_data_files_service_) {}
+
+ protected:
+  void LoadRules(const std::string& contents) {
+    component_installer_.OnDATFileDataReady(contents);
+  }
+
+  brave_component_updater::LocalDataFilesService local_data_files_service_;
+  DebounceComponentInstaller component_installer_;
+};
+
+TEST_F(DebounceComponentInstallerTest, GetRuleIndices) {
+  LoadRules(R"([
+    {
+      "include": ["*://*.a.com/*", "https://a.com/path/*"],
+      "action": "redirect",
+      "param": "url"
+    },
+    {
+      "include": ["*://*/*"],
+      "action": "redirect",
+      "param": "url"
+    },
+    {
+      "include": ["*://b.com/*"],
+      "action": "redirect",
+      "param": "url"
+    },
+    {
+      "include": ["*://*.co.uk/*"],
+      "action": "redirect",
+      "param": "url"
+    },
+    {
+      "include": ["*://a.com/*", "*://b.com/*"],
+      "action": "redirect",
+      "param": "url"
+    },
+    {
+      "include": ["http://127.0.0.1/*"],
+      "action": "redirect",
+      "param": "url"
+    },
+    {
+      "include": ["*://c.com/*"],
+      "action": "unknown",
+      "param": "url"
+    },
+    {
+      "include": ["*://c.com/*"],
+      "action": "base64,redirect",
+      "param": "url"
+    }
+  ])");
+
+  // The rule with an unknown action is dropped, so indices after it are
+  // shifted.
+  ASSERT_EQ(component_installer_.rules().size(), 7u);
+
+  // Site-agnostic rules: a host-less pattern, a public suffix and an IP.
+  EXPECT_EQ(component_installer_.GetRuleIndices("other.com"),
+            (std::vector<size_t>{1, 3, 5}));
+  EXPECT_EQ(component_installer_.GetRuleIndices(""),
+            (std::vector<size_t>{1, 3, 5}));
+
+  // Each site's rules are listed once and merged with the site-agnostic ones
+  // in the order the rules are applied.
+  EXPECT_EQ(component_installer_.GetRuleIndices("a.com"),
+            (std::vector<size_t>{0, 1, 3, 4, 5}));
+  EXPECT_EQ(component_installer_.GetRuleIndices("b.com"),
+            (std::vector<size_t>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(component_installer_.GetRuleIndices("c.com"),
+            (std::vector<size_t>{1, 3, 5, 6}));
+
+  EXPECT_TRUE(base::Contains(component_installer_.host_cache(), "a.com"));
+  EXPECT_TRUE(base::Contains(component_installer_.host_cache(), "b.com"));
+  EXPECT_TRUE(base::Contains(component_installer_.host_cache(), "c.com"));
+  EXPECT_FALSE(base::Contains(component_installer_.host_cache(), "other.com"));
+
+  // Loading new rules replaces the index.
+  LoadRules(R"([
+    {
+      "include": ["*://b.com/*"],
+      "action": "redirect",
+      "param": "url"
+    }
+  ])");
+  ASSERT_EQ(component_installer_.rules().size(), 1u);
+  EXPECT_TRUE(component_installer_.GetRuleIndices("a.com").empty());
+  EXPECT_EQ(component_installer_.GetRuleIndices("b.com"),
+            (std::vector<size_t>{0}));
+}
+
+TEST_F(DebounceComponentInstallerTest, DebounceLooksUpRulesAfterRedirect) {
+  LoadRules(R"([
+    {
+      "include": ["*://b.com/*"],
+      "action": "redirect",
+      "param": "url"
+    },
+    {
+      "include": ["*://a.com/*"],
+      "action": "redirect",
+      "param": "url"
+    },
+    {
+      "include": ["*://b.com/*"],
+      "action": "redirect",
+      "param": "next"
+    }
+  ])");
+  DebounceService debounce_service(&component_installer_);
+
+  const GURL landing_url("https://c.com/");
+  // Rule 0 would send this URL to d.com, but it comes before the rule which
+  // led to b.com, so it's not applied.
+  GURL b_url = net::AppendOrReplaceQueryParameter(GURL("https://b.com/"),
+                                                  "url", "https://d.com/");
+  b_url = net::AppendOrReplaceQueryParameter(b_url, "next", landing_url.spec());
+  const GURL a_url = net::AppendOrReplaceQueryParameter(
+      GURL("https://a.com/"), "url", b_url.spec());
+
+  // The rules for b.com are only candidates once the URL is on b.com.
+  GURL final_url;
+  EXPECT_TRUE(debounce_service.Debounce(a_url, &final_url));
+  EXPECT_EQ(final_url, landing_url);
+
+  // Starting on b.com, rule 0 is a candidate.
+  EXPECT_TRUE(debounce_service.Debounce(b_url, &final_url));
+  EXPECT_EQ(final_url, GURL("https://d.com/"));
+
+  // Sites without rules are left alone.
+  EXPECT_FALSE(debounce_service.Debounce(landing_url, &final_url));
+}
+
+}  // namespace debounce
@@ -0,0 +1,82 @@
+// Copyright (c) 2022 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// you can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "brave/components/ntp_background_images/browser/ntp_wallpaper_cache.h"
+
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/callback_helpers.h"
+#include "base/files/file_util.h"
+#include "base/task/thread_pool.h"
+
+namespace ntp_background_images {
+
+namespace {
+
+scoped_refptr<base::RefCountedMemory> ReadImageFile(
+    const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents))
+    return nullptr;
+  return base::RefCountedString::TakeString(&contents);
+}
+
+}  // namespace
+
+NTPWallpaperCache::NTPWallpaperCache() : images_(kMaxImages) {}
+
+NTPWallpaperCache::~NTPWallpaperCache() = default;
+
+void NTPWallpaperCache::GetImage(const base::FilePath& image_file_path,
+                                 GetImageCallback callback) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  auto cached = images_.Get(image_file_path);
+  if (cached != images_.end()) {
+    std::move(callback).Run(cached->second);
+    return;
+  }
+
+  auto& callbacks = pending_reads_[image_file_path];
+  callbacks.push_back(std::move(callback));
+  if (callbacks.size() > 1)
+    return;
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ReadImageFile, image_file_path),
+      base::BindOnce(&NTPWallpaperCache::OnReadImage,
+                     weak_factory_.GetWeakPtr(), image_file_path));
+}
+
+void NTPWallpaperCache::Prefetch(const base::FilePath& image_file_path) {
+  if (image_file_path.empty())
+    return;
+  GetImage(image_file_path, base::DoNothing());
+}
+
+bool NTPWallpaperCache::HasImageForTesting(
+    const base::FilePath& image_file_path) const {
+  return images_.Peek(image_file_path) != images_.end();
+}
+
+void NTPWallpaperCache::OnReadImage(
+    const base::FilePath& image_file_path,
+    scoped_refptr<base::RefCountedMemory> image) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (image)
+    images_.Put(image_file_path, image);
+
+  auto node = pending_reads_.extract(image_file_path);
+  if (node.empty())
+    return;
+  for (auto& callback : node.mapped())
+    std::move(callback).Run(image);
+}
+
+}  // namespace ntp_background_images
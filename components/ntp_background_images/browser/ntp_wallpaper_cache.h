@@ -0,0 +1,66 @@
+// Copyright (c) 2022 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// you can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_WALLPAPER_CACHE_H_
+#define BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_WALLPAPER_CACHE_H_
+
+#include <map>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequence_checker.h"
+
+namespace ntp_background_images {
+
+// Keeps the last few wallpaper images in memory, so that opening a new tab
+// doesn't have to wait for a multi-megabyte file read. Images can be read
+// ahead of time once it's known which wallpaper will be shown next.
+//
+// Only for images from components, whose files don't change in place.
+class NTPWallpaperCache {
+ public:
+  using GetImageCallback =
+      base::OnceCallback<void(scoped_refptr<base::RefCountedMemory>)>;
+
+  // Enough for a sponsored image and its logo, and the current and next
+  // background images.
+  static constexpr size_t kMaxImages = 4;
+
+  NTPWallpaperCache();
+  ~NTPWallpaperCache();
+
+  NTPWallpaperCache(const NTPWallpaperCache&) = delete;
+  NTPWallpaperCache& operator=(const NTPWallpaperCache&) = delete;
+
+  // Runs |callback| with the contents of |image_file_path|, or with nullptr
+  // if it can't be read.
+  void GetImage(const base::FilePath& image_file_path,
+                GetImageCallback callback);
+
+  // Reads |image_file_path| into the cache if it isn't there yet.
+  void Prefetch(const base::FilePath& image_file_path);
+
+  bool HasImageForTesting(const base::FilePath& image_file_path) const;
+
+ private:
+  void OnReadImage(const base::FilePath& image_file_path,
+                   scoped_refptr<base::RefCountedMemory> image);
+
+  base::LRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>>
+      images_;
+  // Callbacks waiting for a read that is in progress.
+  std::map<base::FilePath, std::vector<GetImageCallback>> pending_reads_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+  base::WeakPtrFactory<NTPWallpaperCache> weak_factory_{this};
+};
+
+}  // namespace ntp_background_images
+
+#endif  // BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_WALLPAPER_CACHE_H_
@@ -0,0 +1,96 @@
+// Copyright (c) 2022 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// you can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "brave/components/ntp_background_images/browser/ntp_wallpaper_cache.h"
+
+#include <string>
+
+#include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/run_loop.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ntp_background_images {
+
+class NTPWallpaperCacheTest : public testing::Test {
+ public:
+  NTPWallpaperCacheTest() = default;
+  ~NTPWallpaperCacheTest() override = default;
+
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+ protected:
+  base::FilePath WriteImage(const std::string& name,
+                            const std::string& contents) {
+    const base::FilePath path = temp_dir_.GetPath().AppendASCII(name);
+    EXPECT_TRUE(base::WriteFile(path, contents));
+    return path;
+  }
+
+  scoped_refptr<base::RefCountedMemory> GetImage(const base::FilePath& path) {
+    scoped_refptr<base::RefCountedMemory> result;
+    base::RunLoop run_loop;
+    cache_.GetImage(path, base::BindOnce(
+                              [](scoped_refptr<base::RefCountedMemory>* result,
+                                 base::OnceClosure quit,
+                                 scoped_refptr<base::RefCountedMemory> image) {
+                                *result = std::move(image);
+                                std::move(quit).Run();
+                              },
+                              &result, run_loop.QuitClosure()));
+    run_loop.Run();
+    return result;
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  NTPWallpaperCache cache_;
+};
+
+TEST_F(NTPWallpaperCacheTest, ServesFromMemory) {
+  const base::FilePath path = WriteImage("wallpaper.jpg", "image data");
+
+  auto image = GetImage(path);
+  ASSERT_TRUE(image);
+  EXPECT_EQ("image data", std::string(image->front_as<char>(), image->size()));
+  EXPECT_TRUE(cache_.HasImageForTesting(path));
+
+  // Later requests don't touch the disk.
+  ASSERT_TRUE(base::DeleteFile(path));
+  image = GetImage(path);
+  ASSERT_TRUE(image);
+  EXPECT_EQ("image data", std::string(image->front_as<char>(), image->size()));
+}
+
+TEST_F(NTPWallpaperCacheTest, MissingFile) {
+  const base::FilePath path = temp_dir_.GetPath().AppendASCII("missing.jpg");
+  EXPECT_FALSE(GetImage(path));
+  EXPECT_FALSE(cache_.HasImageForTesting(path));
+}
+
+TEST_F(NTPWallpaperCacheTest, Prefetch) {
+  const base::FilePath path = WriteImage("wallpaper.jpg", "image data");
+  cache_.Prefetch(path);
+  EXPECT_FALSE(cache_.HasImageForTesting(path));
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(cache_.HasImageForTesting(path));
+}
+
+TEST_F(NTPWallpaperCacheTest, EvictsLeastRecentlyUsed) {
+  const base::FilePath first = WriteImage("wallpaper-0.jpg", "0");
+  ASSERT_TRUE(GetImage(first));
+
+  for (size_t i = 1; i <= NTPWallpaperCache::kMaxImages; ++i) {
+    const std::string name = "wallpaper-" + base::NumberToString(i) + ".jpg";
+    ASSERT_TRUE(GetImage(WriteImage(name, name)));
+  }
+
+  EXPECT_FALSE(cache_.HasImageForTesting(first));
+}
+
+}  // namespace ntp_background_images
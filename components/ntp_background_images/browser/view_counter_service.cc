@@ -265,6 +265,50 @@ void ViewCounterService::RegisterPageView() {
   // This will be no-op when component is not ready.
   service_->CheckNTPSIComponentUpdateIfNeeded();
   model_.RegisterPageView();
+  PrefetchWallpapers();
+}
+
+void ViewCounterService::PrefetchWallpapers() {
+#if !BUILDFLAG(IS_ANDROID)
+  auto* cache = service_->wallpaper_cache();
+  const bool show_branded_wallpaper = ShouldShowBrandedWallpaper();
+  if (show_branded_wallpaper) {
+    auto* data = GetCurrentBrandedWallpaperData();
+    size_t campaign_index;
+    size_t background_index;
+    std::tie(campaign_index, background_index) =
+        model_.GetCurrentBrandedImageIndex();
+    if (data && campaign_index < data->campaigns.size() &&
+        background_index <
+            data->campaigns[campaign_index].backgrounds.size()) {
+      const auto& background =
+          data->campaigns[campaign_index].backgrounds[background_index];
+      cache->Prefetch(background.image_file);
+      cache->Prefetch(background.logo.image_file);
+    }
+  }
+
+  if (!IsBackgroundWallpaperActive())
+    return;
+
+#if BUILDFLAG(ENABLE_CUSTOM_BACKGROUND)
+  if (custom_bi_service_ && custom_bi_service_->ShouldShowCustomBackground())
+    return;
+#endif
+
+  const auto& backgrounds = GetCurrentWallpaperData()->backgrounds;
+  if (backgrounds.empty())
+    return;
+
+  // The background index doesn't move while a branded wallpaper is shown, so
+  // the current background is the one for the next new tab.
+  const size_t index = model_.current_wallpaper_image_index();
+  if (index >= backgrounds.size())
+    return;
+  cache->Prefetch(backgrounds[index].image_file);
+  if (!show_branded_wallpaper)
+    cache->Prefetch(backgrounds[(index + 1) % backgrounds.size()].image_file);
+#endif  // !BUILDFLAG(IS_ANDROID)
 }
 
 void ViewCounterService::BrandedWallpaperLogoClicked(
@@ -142,6 +142,10 @@ class ViewCounterService : public KeyedService,
 
   void ResetModel();
 
+  // Reads the wallpapers for this and the next new tab into memory, so that
+  // they don't need to be read from disk when the page asks for them.
+  void PrefetchWallpapers();
+
   void UpdateP3AValues() const;
 
   raw_ptr<NTPBackgroundImagesService> service_ = nullptr;
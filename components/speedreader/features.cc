@@ -21,4 +21,9 @@ const base::Feature kSpeedreaderFeature {
 const base::FeatureParam<int> kSpeedreaderMinOutLengthParam{
     &kSpeedreaderFeature, "min_out_length", 1000};
 
+// When enabled, the response body is written to the rewriter as it arrives
+// instead of all at once after the download finishes.
+const base::FeatureParam<bool> kSpeedreaderStreamingParam{
+    &kSpeedreaderFeature, "streaming", false};
+
 }  // namespace speedreader
@@ -12,6 +12,7 @@
 namespace speedreader {
 extern const base::Feature kSpeedreaderFeature;
 extern const base::FeatureParam<int> kSpeedreaderMinOutLengthParam;
+extern const base::FeatureParam<bool> kSpeedreaderStreamingParam;
 }  // namespace speedreader
 
 #endif  // BRAVE_COMPONENTS_SPEEDREADER_FEATURES_H_
@@ -15,7 +15,9 @@
 #include "base/metrics/histogram_macros.h"
 #include "base/task/task_traits.h"
 #include "base/task/thread_pool.h"
+#include "base/timer/elapsed_timer.h"
 #include "brave/components/body_sniffer/body_sniffer_throttle.h"
+#include "brave/components/speedreader/features.h"
 #include "brave/components/speedreader/rust/ffi/speedreader.h"
 #include "brave/components/speedreader/speedreader_result_delegate.h"
 #include "brave/components/speedreader/speedreader_rewriter_service.h"
@@ -28,8 +30,63 @@ namespace {
 
 constexpr uint32_t kReadBufferSize = 32768;
 
+// TODO(brave-browser/issues/10372): would be better to pass explicit signal
+// back from rewriter to indicate if content was found
+constexpr size_t kMinDistilledLength = 1024;
+
 }  // namespace
 
+// Owns a rewriter which is fed one chunk of the body at a time. Lives on a
+// worker sequence so that distilling never blocks the loader's thread.
+class SpeedReaderURLLoader::ChunkedRewriter {
+ public:
+  explicit ChunkedRewriter(std::unique_ptr<Rewriter> rewriter)
+      : rewriter_(std::move(rewriter)) {}
+  ChunkedRewriter(const ChunkedRewriter&) = delete;
+  ChunkedRewriter& operator=(const ChunkedRewriter&) = delete;
+  ~ChunkedRewriter() = default;
+
+  void Write(std::string chunk) {
+    if (failed_) {
+      return;
+    }
+
+    base::ElapsedTimer timer;
+    failed_ = rewriter_->Write(chunk.c_str(), chunk.length()) != 0;
+    distill_time_ += timer.Elapsed();
+  }
+
+  // Returns the distilled page prefixed with |stylesheet|, or an empty string
+  // if the original page should be shown.
+  std::string End(const std::string& stylesheet) {
+    if (failed_) {
+      UMA_HISTOGRAM_TIMES("Brave.Speedreader.Distill", distill_time_);
+      return std::string();
+    }
+
+    base::ElapsedTimer timer;
+    rewriter_->End();
+    const std::string& transformed = rewriter_->GetOutput();
+    distill_time_ += timer.Elapsed();
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.Distill", distill_time_);
+
+    if (transformed.length() < kMinDistilledLength) {
+      return std::string();
+    }
+
+    std::string distilled;
+    distilled.reserve(stylesheet.length() + transformed.length());
+    distilled.append(stylesheet);
+    distilled.append(transformed);
+    return distilled;
+  }
+
+ private:
+  std::unique_ptr<Rewriter> rewriter_;
+  bool failed_ = false;
+  base::TimeDelta distill_time_;
+};
+
 // static
 std::tuple<mojo::PendingRemote<network::mojom::URLLoader>,
            mojo::PendingReceiver<network::mojom::URLLoaderClient>,
@@ -70,25 +127,55 @@ SpeedReaderURLLoader::SpeedReaderURLLoader(
           std::move(destination_url_loader_client),
           task_runner),
       delegate_(delegate),
-      rewriter_service_(rewriter_service) {}
+      rewriter_service_(rewriter_service),
+      chunked_rewriter_(nullptr, base::OnTaskRunnerDeleter(nullptr)) {
+  if (rewriter_service_ && kSpeedreaderStreamingParam.Get()) {
+    rewriter_task_runner_ = base::ThreadPool::CreateSequencedTaskRunner(
+        {base::TaskPriority::USER_BLOCKING});
+    chunked_rewriter_ =
+        std::unique_ptr<ChunkedRewriter, base::OnTaskRunnerDeleter>(
+            new ChunkedRewriter(rewriter_service_->MakeRewriter(response_url)),
+            base::OnTaskRunnerDeleter(rewriter_task_runner_));
+  }
+}
 
 SpeedReaderURLLoader::~SpeedReaderURLLoader() = default;
 
 void SpeedReaderURLLoader::OnBodyReadable(MojoResult) {
   DCHECK_EQ(State::kLoading, state_);
 
+  if (first_body_read_time_.is_null()) {
+    first_body_read_time_ = base::TimeTicks::Now();
+  }
+
   if (!BodySnifferURLLoader::CheckBufferedBody(kReadBufferSize)) {
     return;
   }
 
-  // TODO(iefremov): We actually can partially |pumpContent| to speedreader,
-  // but skipping it for now to simplify things. Pumping is not free in terms
-  // of CPU ticks, so we will have to keep alive speedreader instance on another
-  // thread.
+  if (chunked_rewriter_) {
+    WriteBufferedBodyToRewriter();
+  }
 
   body_consumer_watcher_.ArmOrNotify();
 }
 
+void SpeedReaderURLLoader::WriteBufferedBodyToRewriter() {
+  DCHECK(chunked_rewriter_);
+  DCHECK_LE(bytes_written_to_rewriter_, buffered_body_.size());
+  if (bytes_written_to_rewriter_ == buffered_body_.size()) {
+    return;
+  }
+
+  // base::Unretained is safe because |chunked_rewriter_| is deleted on
+  // |rewriter_task_runner_| after every task posted here has run.
+  rewriter_task_runner_->PostTask(
+      FROM_HERE,
+      base::BindOnce(&ChunkedRewriter::Write,
+                     base::Unretained(chunked_rewriter_.get()),
+                     buffered_body_.substr(bytes_written_to_rewriter_)));
+  bytes_written_to_rewriter_ = buffered_body_.size();
+}
+
 void SpeedReaderURLLoader::OnBodyWritable(MojoResult r) {
   DCHECK_EQ(State::kSending, state_);
   if (bytes_remaining_in_buffer_ > 0) {
@@ -108,6 +195,26 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
   VLOG(2) << __func__ << " buffered body size = " << body.size();
   bytes_remaining_in_buffer_ = body.size();
 
+  if (bytes_remaining_in_buffer_ > 0 && chunked_rewriter_) {
+    // |body| has been moved out of |buffered_body_|, so write whatever part
+    // of it the rewriter has not seen yet directly.
+    DCHECK_LE(bytes_written_to_rewriter_, body.size());
+    rewriter_task_runner_->PostTask(
+        FROM_HERE, base::BindOnce(&ChunkedRewriter::Write,
+                                  base::Unretained(chunked_rewriter_.get()),
+                                  body.substr(bytes_written_to_rewriter_)));
+    bytes_written_to_rewriter_ = body.size();
+
+    rewriter_task_runner_->PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(&ChunkedRewriter::End,
+                       base::Unretained(chunked_rewriter_.get()),
+                       rewriter_service_->GetContentStylesheet()),
+        base::BindOnce(&SpeedReaderURLLoader::OnDistilled,
+                       weak_factory_.GetWeakPtr(), std::move(body)));
+    return;
+  }
+
   if (bytes_remaining_in_buffer_ > 0) {
     // Offload heavy distilling to another thread.
     base::ThreadPool::PostTaskAndReplyWithResult(
@@ -125,10 +232,7 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
               rewriter->End();
               const std::string& transformed = rewriter->GetOutput();
 
-              // TODO(brave-browser/issues/10372): would be better to pass
-              // explicit signal back from rewriter to indicate if content was
-              // found
-              if (transformed.length() < 1024) {
+              if (transformed.length() < kMinDistilledLength) {
                 return data;
               }
 
@@ -139,7 +243,7 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
         base::BindOnce(
             [](base::WeakPtr<SpeedReaderURLLoader> self, std::string result) {
               if (self) {
-                self->BodySnifferURLLoader::CompleteLoading(std::move(result));
+                self->CompleteLoadingAndRecordTiming(std::move(result));
               }
             },
             weak_factory_.GetWeakPtr()));
@@ -148,6 +252,26 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
   BodySnifferURLLoader::CompleteLoading(std::move(body));
 }
 
+void SpeedReaderURLLoader::OnDistilled(std::string body,
+                                       std::string distilled) {
+  if (distilled.empty()) {
+    CompleteLoadingAndRecordTiming(std::move(body));
+    return;
+  }
+
+  CompleteLoadingAndRecordTiming(std::move(distilled));
+}
+
+void SpeedReaderURLLoader::CompleteLoadingAndRecordTiming(std::string body) {
+  // Time from the first body read to distilling being complete, i.e. how long
+  // the page is held back from the renderer.
+  if (!first_body_read_time_.is_null()) {
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.FirstReadToDistillComplete",
+                        base::TimeTicks::Now() - first_body_read_time_);
+  }
+  BodySnifferURLLoader::CompleteLoading(std::move(body));
+}
+
 void SpeedReaderURLLoader::OnCompleteSending() {
   // TODO(keur, iefremov): This API could probably be improved with an enum
   // indicating distill success, distill fail, load from cache.
@@ -6,13 +6,16 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 
+#include <memory>
 #include <string>
 #include <tuple>
 
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/time/time.h"
 #include "brave/components/body_sniffer/body_sniffer_url_loader.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
@@ -42,10 +45,13 @@ class SpeedReaderThrottle;
 //               kCompleted.
 // kLoading: Receives the body from the source loader and distills the page.
 //            The received body is kept in this loader until distilling
-//            is finished. When all body has been received and distilling is
-//            done, this loader will dispatch queued messages like
-//            OnStartLoadingResponseBody() to the destination
-//            loader client, and then the state is changed to kSending.
+//            is finished. In streaming mode each chunk is also written to the
+//            rewriter on a worker sequence as soon as it is read, so only the
+//            end of distilling remains once the last chunk arrives. When all
+//            body has been received and distilling is done, this loader will
+//            dispatch queued messages like OnStartLoadingResponseBody() to
+//            the destination loader client, and then the state is changed to
+//            kSending.
 // kSending: Receives the body and sends it to the destination loader client.
 //           The state changes to kCompleted after all data is sent.
 // kCompleted: All data has been sent to the destination loader.
@@ -82,11 +88,25 @@ class SpeedReaderURLLoader : public body_sniffer::BodySnifferURLLoader {
 
   void CompleteLoading(std::string body) override;
   void OnCompleteSending() override;
+
+  // Writes the part of |buffered_body_| not yet seen by |chunked_rewriter_|.
+  void WriteBufferedBodyToRewriter();
+  void OnDistilled(std::string body, std::string distilled);
+  void CompleteLoadingAndRecordTiming(std::string body);
+
   base::WeakPtr<SpeedreaderResultDelegate> delegate_;
 
   // Not Owned
   raw_ptr<SpeedreaderRewriterService> rewriter_service_ = nullptr;
 
+  // Only set in streaming mode. Used and destroyed on |rewriter_task_runner_|.
+  class ChunkedRewriter;
+  scoped_refptr<base::SequencedTaskRunner> rewriter_task_runner_;
+  std::unique_ptr<ChunkedRewriter, base::OnTaskRunnerDeleter> chunked_rewriter_;
+  size_t bytes_written_to_rewriter_ = 0;
+
+  base::TimeTicks first_body_read_time_;
+
   base::WeakPtrFactory<SpeedReaderURLLoader> weak_factory_{this};
 };
 